@@ -159,23 +159,53 @@ void SystemEnergy::_to_disk() {
     }
 }
 
-void SaveState::_to_json(json &j) const { j["file"] = filename; }
+void SaveState::_to_json(json &j) const { j = {{"file", filename}, {"overwrite", overwrite}}; }
 
 void SaveState::_sample() {
     assert(sample_interval >= 0);
-    // tag filename with step number:
-    auto numbered_filename = filename;
-    numbered_filename.insert(filename.find_last_of("."), "_"s + std::to_string(getNumberOfSteps()));
-    writeFunc(numbered_filename);
+    if (overwrite) {
+        saveAtomically(filename);
+    } else { // tag filename with step number:
+        auto numbered_filename = filename;
+        numbered_filename.insert(filename.find_last_of("."), "_"s + std::to_string(getNumberOfSteps()));
+        saveAtomically(numbered_filename);
+    }
+}
+
+/**
+ * The state is first written to a temporary file which then replaces `file`. A failed
+ * or interrupted write hence never leaves a partially written state file behind, and
+ * the previous file, if any, is kept.
+ *
+ * @return True if `file` was written
+ */
+bool SaveState::saveAtomically(const std::string &file) {
+    const auto temporary_file = file + ".tmp";
+    bool written = false;
+    try {
+        written = writeFunc(temporary_file);
+    } catch (std::exception &e) {
+        faunus_logger->error("{}: {}", name, e.what());
+    }
+    if (!written) {
+        std::remove(temporary_file.c_str());
+        faunus_logger->error("{}: could not write {}", name, file);
+        return false;
+    }
+    if (std::rename(temporary_file.c_str(), file.c_str()) != 0) {
+        faunus_logger->error("{}: could not save {}", name, file);
+        return false;
+    }
+    return true;
 }
 
 SaveState::~SaveState() {
     if (sample_interval == -1) { // writes data just before destruction
-        writeFunc(filename);
+        saveAtomically(filename);
     }
 }
 
-SaveState::SaveState(json j, Space &spc) {
+SaveState::SaveState(json j, Space &spc, const Move::Propagator *moves) : moves(moves) {
     name = "savestate";
 
     if (j.count("nstep") == 0) { // by default, disable _sample() and
@@ -184,16 +214,17 @@ SaveState::SaveState(json j, Space &spc) {
     from_json(j);
 
     save_random_number_generator_state = j.value("saverandom", false);
+    overwrite = j.value("overwrite", false);
     filename = MPI::prefix + j.at("file").get<std::string>();
 
     if (auto suffix = filename.substr(filename.find_last_of(".") + 1); suffix == "aam") {
-        writeFunc = [&](auto &file) { FormatAAM::save(file, spc.p); };
+        writeFunc = [&](auto &file) { return FormatAAM::save(file, spc.p); };
     } else if (suffix == "gro") {
-        writeFunc = [&](auto &file) { FormatGRO::save(file, spc); };
+        writeFunc = [&](auto &file) { return FormatGRO::save(file, spc); };
     } else if (suffix == "pqr") {
-        writeFunc = [&](auto &file) { FormatPQR::save(file, spc.groups, spc.geo.getLength()); };
+        writeFunc = [&](auto &file) { return FormatPQR::save(file, spc.groups, spc.geo.getLength()); };
     } else if (suffix == "xyz") {
-        writeFunc = [&](auto &file) { FormatXYZ::save(file, spc.p, spc.geo.getLength()); };
+        writeFunc = [&](auto &file) { return FormatXYZ::save(file, spc.p, spc.geo.getLength()); };
     } else if (suffix == "json") { // JSON state file
         writeFunc = [&](auto &file) {
             if (std::ofstream f(file); f) {
@@ -204,7 +235,10 @@ SaveState::SaveState(json j, Space &spc) {
                     j["random-global"] = Faunus::random;
                 }
                 f << std::setw(2) << j;
+                f.close();
+                return !f.fail();
             }
+            return false;
         };
     } else if (suffix == "ubj") { // Universal Binary JSON state file
         writeFunc = [&](auto &file) {
@@ -217,7 +251,31 @@ SaveState::SaveState(json j, Space &spc) {
                 }
                 auto v = json::to_ubjson(j); // json --> binary
                 f.write((const char *)v.data(), v.size() * sizeof(decltype(v)::value_type));
+                f.close();
+                return !f.fail();
             }
+            return false;
+        };
+    } else if (suffix == "cpt") { // Binary checkpoint; see `MetropolisMonteCarlo::restore()`
+        writeFunc = [&](auto &file) {
+            if (std::ofstream f(file, std::ios::binary); f) {
+                {
+                    cereal::BinaryOutputArchive archive(f);
+                    archive("faunus-checkpoint"s, std::uint32_t(1), spc, save_random_number_generator_state);
+                    if (save_random_number_generator_state) {
+                        archive(json(Move::Movebase::slump).dump(), json(Faunus::random).dump());
+                    }
+                    archive(moves ? moves->moves().size() : size_t(0));
+                    if (moves) {
+                        for (const auto &move : moves->moves()) {
+                            archive(move->name, *move);
+                        }
+                    }
+                }
+                f.close();
+                return !f.fail();
+            }
+            return false;
         };
     } else {
         throw std::runtime_error("unknown file extension for '" + filename + "'");
@@ -280,13 +338,56 @@ void PairAngleFunctionBase::_to_disk() {
 
 void PairAngleFunctionBase::_from_json(const json &) { hist2.setResolution(dr, 0); }
 
+/**
+ * The position buffers keep their capacity between samples. Only the box dimensions of the geometry are
+ * stored, as copying it would clone its implementation on the heap.
+ */
+void VirtualVolume::saveSnapshot() {
+    positions_snapshot.resize(spc.p.size());
+    std::transform(spc.p.begin(), spc.p.end(), positions_snapshot.begin(), [](auto &particle) { return particle.pos; });
+    mass_centers_snapshot.resize(spc.groups.size());
+    std::transform(spc.groups.begin(), spc.groups.end(), mass_centers_snapshot.begin(),
+                   [](auto &group) { return group.cm; });
+    box_length_snapshot = spc.geo.getLength();
+    volume_snapshot = spc.geo.getVolume();
+}
+
+/**
+ * Unlike scaling back to the original volume, positions and cuboid box lengths are restored exactly.
+ * Other geometries are scaled back to the original volume.
+ */
+void VirtualVolume::restoreSnapshot() {
+    assert(positions_snapshot.size() == spc.p.size() && mass_centers_snapshot.size() == spc.groups.size());
+    auto position = positions_snapshot.begin();
+    for (auto &particle : spc.p) {
+        particle.pos = *position++;
+    }
+    auto mass_center = mass_centers_snapshot.begin();
+    for (auto &group : spc.groups) {
+        group.cm = *mass_center++;
+    }
+    if (spc.geo.type == Geometry::CUBOID) {
+        spc.geo.setLength(box_length_snapshot);
+    } else {
+        spc.geo.setVolume(volume_snapshot, volume_scaling_method);
+    }
+}
+
 void VirtualVolume::_sample() {
     if (fabs(dV) > 1e-10) {
-        double old_volume = spc.geo.getVolume();                              // store old volume
-        double old_energy = pot.energy(change);                               // ...and energy
+        double old_volume = spc.geo.getVolume(); // store old volume
+        double old_energy = pot.energy(change);  // ...and energy
+        if (use_snapshot) {
+            saveSnapshot();
+        }
+        // the energy is evaluated on the live system which is then restored
         auto scale = spc.scaleVolume(old_volume + dV, volume_scaling_method); // scale entire system to new volume
         double new_energy = pot.energy(change);                               // energy after scaling
-        spc.scaleVolume(old_volume, volume_scaling_method);                   // restore saved system
+        if (use_snapshot) {
+            restoreSnapshot(); // restore saved system
+        } else {
+            spc.scaleVolume(old_volume, volume_scaling_method); // restore saved system
+        }
 
         double du = new_energy - old_energy; // system energy change
         if (-du < pc::max_exp_argument) {    // does minus energy change fit exp() function?
@@ -315,7 +416,7 @@ void VirtualVolume::_sample() {
             // Check if volume and particle positions are properly restored.
             // Expensive and one would normally not perform this test and we trigger it
             // only when using log-level "debug" or lower
-            if (faunus_logger->level() <= spdlog::level::debug and old_energy != 0) {
+            if (not use_snapshot and faunus_logger->level() <= spdlog::level::debug and old_energy != 0) {
                 double should_be_small = std::fabs((old_energy - pot.energy(change)) / old_energy); // expensive!
                 if (should_be_small > 1e-6) {
                     faunus_logger->error("{} failed to restore system", name);
@@ -330,6 +431,7 @@ void VirtualVolume::_sample() {
 
 void VirtualVolume::_from_json(const json &j) {
     dV = j.at("dV");
+    use_snapshot = j.value("snapshot", true);
     volume_scaling_method = j.value("scaling", Geometry::ISOTROPIC);
     if (volume_scaling_method == Geometry::ISOCHORIC) {
         throw std::runtime_error(name + ": isochoric volume scaling not allowed");
@@ -365,6 +467,7 @@ void VirtualVolume::_to_json(json &j) const {
         double excess_pressure = log(mean_exponentiated_energy_change.avg()) / dV;
         j = {{"dV", dV},
              {"scaling", volume_scaling_method},
+             {"snapshot", use_snapshot},
              {"-ln\u27e8exp(-dU)\u27e9", -std::log(mean_exponentiated_energy_change.avg())},
              {"Pex/mM", excess_pressure / 1.0_millimolar},
              {"Pex/Pa", excess_pressure / 1.0_Pa},
@@ -422,7 +525,11 @@ void CombinedAnalysis::to_disk() {
         ptr->to_disk();
 }
 
-CombinedAnalysis::CombinedAnalysis(const json &j, Space &spc, Energy::Hamiltonian &pot) {
+/**
+ * @param moves  optional MC moves; their statistics are stored in binary checkpoints
+ */
+CombinedAnalysis::CombinedAnalysis(const json &j, Space &spc, Energy::Hamiltonian &pot,
+                                   const Move::Propagator *moves) {
     if (j.is_array()) {
         for (auto &m : j) {
             for (auto it = m.begin(); it != m.end(); ++it) {
@@ -460,7 +567,7 @@ CombinedAnalysis::CombinedAnalysis(const json &j, Space &spc, Energy::Hamiltonia
                         else if (it.key() == "sanity")
                             emplace_back<SanityCheck>(it.value(), spc);
                         else if (it.key() == "savestate")
-                            emplace_back<SaveState>(it.value(), spc);
+                            emplace_back<SaveState>(it.value(), spc, moves);
                         else if (it.key() == "scatter")
                             emplace_back<ScatteringFunction>(it.value(), spc);
                         else if (it.key() == "sliceddensity")
@@ -536,7 +643,9 @@ void FileReactionCoordinate::_to_disk() {
 }
 
 void WidomInsertion::_sample() {
-    if (!change.empty()) {
+    if (parallel && !change.empty()) {
+        sampleParallel();
+    } else if (!change.empty()) {
         ParticleVector pin;
         auto &g = spc.groups.at(change.groups.at(0).index);
         assert(g.empty() && g.capacity() > 0);
@@ -562,12 +671,51 @@ void WidomInsertion::_sample() {
     }
 }
 
+/**
+ * Each thread generates test particles with a private inserter, random number generator and molecule
+ * (conformation sampling is stateful) and evaluates the energy of the ghost group, i.e. a group that
+ * is never copied into Space. The thread-private averages are reduced at the end.
+ */
+void WidomInsertion::sampleParallel() {
+#pragma omp parallel default(shared)
+    {
+        Random thread_random;
+#pragma omp critical
+        thread_random.engine.seed(Faunus::random.engine()); // draw seeds from the global generator
+        auto thread_inserter = rins;
+        thread_inserter.random_engine = &thread_random;
+        auto thread_molecule = molecules.at(molid);
+        Average<double> thread_expu;
+        ParticleVector pin;
+#pragma omp for schedule(static)
+        for (int i = 0; i < ninsert; ++i) {
+            pin = thread_inserter(spc.geo, spc.p, thread_molecule);
+            if (not pin.empty()) {
+                if (absolute_z) {
+                    for (auto &p : pin)
+                        p.pos.z() = std::fabs(p.pos.z());
+                }
+                Space::Tgroup ghost(pin.begin(), pin.end());
+                ghost.id = molid;
+                ghost.atomic = thread_molecule.atomic;
+                if (not ghost.atomic) // update molecular mass-center
+                    ghost.cm = Geometry::massCenter(ghost.begin(), ghost.end(), spc.geo.getBoundaryFunc(),
+                                                    -ghost.begin()->pos);
+                thread_expu += std::exp(-pot->ghostEnergy(ghost)); // widom average
+            }
+        }
+#pragma omp critical
+        expu = expu + thread_expu;
+    }
+}
+
 void WidomInsertion::_to_json(json &j) const {
     double excess = -std::log(expu.avg());
     j = {{"dir", rins.dir},
          {"molecule", molname},
          {"insertions", expu.cnt},
          {"absz", absolute_z},
+         {"parallel", parallel},
          {u8::mu + "/kT", {{"excess", excess}}}};
 }
 
@@ -575,6 +723,7 @@ void WidomInsertion::_from_json(const json &j) {
     ninsert = j.at("ninsert");
     molname = j.at("molecule");
     absolute_z = j.value("absz", false);
+    parallel = j.value("parallel", false);
     rins.dir = j.value("dir", Point({1, 1, 1}));
 
     if (auto it = findName(molecules, molname); it != molecules.end()) { // loop for molecule in topology
@@ -598,9 +747,20 @@ void WidomInsertion::_from_json(const json &j) {
 }
 
 WidomInsertion::WidomInsertion(const json &j, Space &spc, Energy::Hamiltonian &pot) : spc(spc), pot(&pot) {
-    from_json(j);
     name = "widom";
     cite = "doi:10/dkv4s6";
+    from_json(j);
+    if (parallel) { // probe the Hamiltonian with an empty ghost group
+        ParticleVector empty;
+        Space::Tgroup ghost(empty.begin(), empty.end());
+        ghost.id = molid;
+        ghost.atomic = molecules.at(molid).atomic;
+        try {
+            pot.ghostEnergy(ghost);
+        } catch (std::logic_error &e) {
+            throw ConfigurationError(name + ": 'parallel' unsupported by Hamiltonian: "s + e.what());
+        }
+    }
 }
 
 void Density::_sample() {
@@ -1543,6 +1703,10 @@ SpaceTrajectory::SpaceTrajectory(const json &j, Space::Tgvec &groups) : groups(g
     from_json(j);
     name = "space trajectory";
     filename = j.at("file");
+    if (useIndex()) {
+        indexed_writer = std::make_unique<IndexedSpaceTrajectoryWriter>(MPI::prefix + filename);
+        return;
+    }
     if (useCompression())
         stream = std::make_unique<zstr::ofstream>(MPI::prefix + filename, std::ios::binary);
     else
@@ -1555,6 +1719,11 @@ SpaceTrajectory::SpaceTrajectory(const json &j, Space::Tgvec &groups) : groups(g
         throw std::runtime_error("error creating "s + filename);
 }
 
+bool SpaceTrajectory::useIndex() const {
+    assert(!filename.empty());
+    return filename.substr(filename.find_last_of(".") + 1) == "itraj";
+}
+
 bool SpaceTrajectory::useCompression() const {
     assert(!filename.empty());
     std::string suffix = filename.substr(filename.find_last_of(".") + 1);
@@ -1563,10 +1732,14 @@ bool SpaceTrajectory::useCompression() const {
     else if (suffix == "traj")
         return false;
     else
-        throw std::runtime_error("Trajectory file suffix must be `.traj` or `.ztraj`");
+        throw std::runtime_error("Trajectory file suffix must be `.traj`, `.ztraj`, or `.itraj`");
 }
 
 void SpaceTrajectory::_sample() {
+    if (indexed_writer) {
+        indexed_writer->save(groups);
+        return;
+    }
     assert(archive);
     for (auto &group : groups) {
         (*archive)(group);
@@ -1576,8 +1749,12 @@ void SpaceTrajectory::_sample() {
 void SpaceTrajectory::_to_json(json &j) const { j = {{"file", filename}}; }
 
 void SpaceTrajectory::_to_disk() {
-    assert(*stream);
-    stream->flush();
+    if (indexed_writer) {
+        indexed_writer->flush();
+    } else {
+        assert(*stream);
+        stream->flush();
+    }
 }
 } // namespace Analysis
 } // namespace Faunus
@@ -18,6 +18,10 @@ class Hamiltonian;
 class Energybase;
 } // namespace Energy
 
+namespace Move {
+class Propagator;
+}
+
 namespace Analysis {
 
 /**
@@ -76,6 +80,11 @@ class FileReactionCoordinate : public Analysisbase {
 
 /**
  * @brief Excess chemical potential of molecules
+ *
+ * In parallel mode the insertions are distributed over OpenMP threads, each with a private
+ * ghost group and random number generator. Energies are then evaluated with
+ * `Energy::Hamiltonian::ghostEnergy()` which leaves Space untouched, but is supported only
+ * by a subset of energy terms.
  */
 class WidomInsertion : public Analysisbase {
     Space &spc;
@@ -85,9 +94,11 @@ class WidomInsertion : public Analysisbase {
     int ninsert;
     int molid; // molecule id
     bool absolute_z = false;
+    bool parallel = false; //!< Insert on several threads using ghost energies
     Average<double> expu;
     Change change;
 
+    void sampleParallel(); //!< Thread-parallel insertion without modifying Space
     void _sample() override;
     void _to_json(json &j) const override;
     void _from_json(const json &j) override;
@@ -253,18 +264,22 @@ class SanityCheck : public Analysisbase {
  * If the sample interval is set to the special value -1, the
  * analysis is called exclusively at the very end of the simulation.
  * If sample interval >= 0 the analysis is performed as per usual and
- * each saved configuration file is named with the step count.
+ * each saved configuration file is named with the step count unless
+ * `overwrite` is set, which is useful for periodic checkpoints.
  */
 class SaveState : public Analysisbase {
   private:
-    std::function<void(const std::string &)> writeFunc = nullptr;
+    std::function<bool(const std::string &)> writeFunc = nullptr; //!< Returns false if the file could not be written
     bool save_random_number_generator_state = false;
+    bool overwrite = false; //!< Overwrite `filename` instead of tagging with step count
     std::string filename;
+    const Move::Propagator *moves = nullptr; //!< Moves whose statistics are stored in binary checkpoints
+    bool saveAtomically(const std::string &file); //!< Write to temporary file and then rename
     void _to_json(json &) const override;
     void _sample() override;
 
   public:
-    SaveState(json, Space &);
+    SaveState(json, Space &, const Move::Propagator *moves = nullptr);
     ~SaveState();
 };
 
@@ -354,7 +369,7 @@ class XTCtraj : public Analysisbase {
  * @brief Excess pressure using virtual volume move
  */
 class VirtualVolume : public Analysisbase {
-    Space spc;
+    Space &spc;
     Geometry::VolumeMethod volume_scaling_method = Geometry::ISOTROPIC;
     std::string filename;                                  // output filename (optional)
     std::unique_ptr<std::ostream> output_stream = nullptr; // output file stream
@@ -362,7 +377,14 @@ class VirtualVolume : public Analysisbase {
     Change change;
     Energy::Energybase &pot;
     Average<double> mean_exponentiated_energy_change; // < exp(-du/kT) >
-
+    bool use_snapshot = true;                          // restore from snapshot instead of scaling back
+    std::vector<Point> positions_snapshot;             // positions before perturbation (reused)
+    std::vector<Point> mass_centers_snapshot;          // group mass centers before perturbation (reused)
+    Point box_length_snapshot = {0, 0, 0};             // box lengths before perturbation
+    double volume_snapshot = 0.0;                      // volume before perturbation
+
+    void saveSnapshot();    //!< Copy positions, mass centers and box dimensions into reusable buffers
+    void restoreSnapshot(); //!< Exact restore of Space from buffers
     void _sample() override;
     void _from_json(const json &) override;
     void _to_json(json &) const override;
@@ -574,7 +596,9 @@ class QRtraj : public Analysisbase {
  * - all group properties (id, size, capacity etc.)
  *
  * If zlib compression is enabled the file size
- * is reduced by roughly a factor of two.
+ * is reduced by roughly a factor of two. The frame-indexed
+ * format (`.itraj`) compresses frames individually to allow
+ * random access, see `IndexedSpaceTrajectoryReader`.
  *
  * @todo Geometry information
  */
@@ -584,17 +608,19 @@ class SpaceTrajectory : public Analysisbase {
     std::string filename;
     std::unique_ptr<std::ostream> stream;
     std::unique_ptr<cereal::BinaryOutputArchive> archive;
+    std::unique_ptr<IndexedSpaceTrajectoryWriter> indexed_writer; //!< used for frame-indexed (.itraj) files
     void _sample() override;
     void _to_json(json &j) const override;
     void _to_disk() override;
     bool useCompression() const; //!< decide from filename if zlib should be used
+    bool useIndex() const;       //!< decide from filename if frames should be indexed
 
   public:
     SpaceTrajectory(const json &, Space::Tgvec &);
 };
 
 struct CombinedAnalysis : public BasePointerVector<Analysisbase> {
-    CombinedAnalysis(const json &j, Space &spc, Energy::Hamiltonian &pot);
+    CombinedAnalysis(const json &j, Space &spc, Energy::Hamiltonian &pot, const Move::Propagator *moves = nullptr);
     void sample();
     void to_disk(); // prompt all analysis to safe to disk if appropriate
 }; //!< Aggregates analysis
@@ -8,6 +8,10 @@
 #include <map>
 #include <regex>
 #include <chrono>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 #include "average.h"
 
@@ -1516,33 +1520,76 @@ namespace Faunus
     }
 #endif
 
+    /**
+     * @brief Low-overhead time stamp for profiling
+     *
+     * On x86 this reads the time-stamp counter which costs a few clock cycles, whereas
+     * `std::chrono::steady_clock::now()` typically involves a (v)system call. Differences
+     * between time stamps can be converted to seconds using `secondsPerTick()`.
+     */
+    inline uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+    /**
+     * @brief Duration of a single tick in seconds
+     *
+     * The time-stamp counter is calibrated against the steady clock on the first call (~10 ms).
+     */
+    inline double secondsPerTick() {
+        static const double seconds_per_tick = [] {
+#if defined(__x86_64__) || defined(__i386__)
+            using namespace std::chrono;
+            const auto start = steady_clock::now();
+            const auto start_ticks = ticks();
+            while (steady_clock::now() - start < milliseconds(10)) {
+            }
+            const auto elapsed = duration<double>(steady_clock::now() - start).count();
+            return elapsed / double(ticks() - start_ticks);
+#else
+            return double(std::chrono::steady_clock::period::num) / std::chrono::steady_clock::period::den;
+#endif
+        }();
+        return seconds_per_tick;
+    }
+
     /**
      * @brief Timer for measuring relative time consumption
      *
      * Time t=0 is set upon construction whereafter combined `start()`/
      * `stop()` calls can be made multiple times. The result is
      * the fraction of total time, consumed in between start/stop calls.
+     * Time is measured using `ticks()` so that the timer can be used in hot paths;
+     * `Tunit` is retained for compatibility only.
      */
     template<typename Tunit = std::chrono::microseconds>
         class TimeRelativeOfTotal
         {
             private:
-                Tunit delta;
-                std::chrono::steady_clock::time_point t0, tx;
+                uint64_t delta = 0;     // accumulated ticks in between start/stop
+                uint64_t num_calls = 0; // number of start/stop pairs
+                uint64_t t0, tx;
             public:
-              TimeRelativeOfTotal() : delta(0) { t0 = std::chrono::steady_clock::now(); }
+              TimeRelativeOfTotal() : t0(ticks()), tx(t0) {}
 
-              operator bool() const { return delta.count() != 0 ? true : false; }
+              operator bool() const { return delta != 0; }
 
-              void start() { tx = std::chrono::steady_clock::now(); }
+              void start() { tx = ticks(); }
 
-              void stop() { delta += std::chrono::duration_cast<Tunit>(std::chrono::steady_clock::now() - tx); }
+              void stop() {
+                  delta += ticks() - tx;
+                  num_calls++;
+              }
 
-              double result() const {
-                  auto now = std::chrono::steady_clock::now();
-                  auto total = std::chrono::duration_cast<Tunit>(now - t0);
-                  return delta.count() / double(total.count());
-                }
+              double result() const { return delta / double(ticks() - t0); } //!< Fraction of total time
+
+              double seconds() const { return delta * secondsPerTick(); } //!< Time in between start/stop calls
+
+              uint64_t calls() const { return num_calls; } //!< Number of start/stop pairs
         };
 
     /**
@@ -1,5 +1,6 @@
 #include "auxiliary.h"
 #include <cmath>
+#include <thread>
 
 namespace Faunus {
 
@@ -27,5 +28,16 @@ TEST_CASE("numeric_cast") {
     #pragma GCC diagnostic pop
 }
 
+TEST_CASE("ticks") {
+    CHECK(secondsPerTick() > 0.0);
+    const auto start_ticks = ticks();
+    const auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const auto stop_ticks = ticks();
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    REQUIRE(stop_ticks > start_ticks);
+    CHECK((stop_ticks - start_ticks) * secondsPerTick() == Approx(elapsed).epsilon(0.2));
+}
+
 TEST_SUITE_END();
 } // namespace Faunus
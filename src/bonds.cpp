@@ -93,6 +93,11 @@ std::shared_ptr<BondData> HarmonicBond::clone() const { return std::make_shared<
 
 BondData::Variant HarmonicBond::type() const { return BondData::HARMONIC; }
 
+double HarmonicBond::energy(ParticleVector::const_iterator first, const Geometry::DistanceFunction &dist) const {
+    double d = req - dist(first[index[0]].pos, first[index[1]].pos).norm();
+    return k_half * d * d; // kT/Å
+}
+
 /**
  * @param particle Particle vector to all particles in the system
  *
@@ -101,10 +106,7 @@ BondData::Variant HarmonicBond::type() const { return BondData::HARMONIC; }
  * participating atoms
  */
 void HarmonicBond::setEnergyFunction(const ParticleVector &particle) {
-    energyFunc = [&](Geometry::DistanceFunction dist) { // potential energy functor
-        double d = req - dist(particle[index[0]].pos, particle[index[1]].pos).norm();
-        return k_half * d * d; // kT/Å
-    };
+    energyFunc = [&](Geometry::DistanceFunction dist) { return energy(particle.cbegin(), dist); };
     forceFunc = [&](Geometry::DistanceFunction dist) -> std::vector<Point> { // force functor
         auto rvec = dist(particle[index[0]].pos, particle[index[1]].pos); // vector between points
         double r = rvec.norm();                                           // distance between particles
@@ -131,12 +133,13 @@ void FENEBond::to_json(Faunus::json &j) const {
 
 std::string FENEBond::name() const { return "fene"; }
 
+double FENEBond::energy(ParticleVector::const_iterator first, const Geometry::DistanceFunction &dist) const {
+    double r_squared = dist(first[index[0]].pos, first[index[1]].pos).squaredNorm();
+    return (r_squared >= rmax_squared) ? pc::infty : -k_half * rmax_squared * std::log(1 - r_squared / rmax_squared);
+}
+
 void FENEBond::setEnergyFunction(const ParticleVector &p) {
-    energyFunc = [&](Geometry::DistanceFunction dist) {
-        double r_squared = dist(p[index[0]].pos, p[index[1]].pos).squaredNorm();
-        return (r_squared >= rmax_squared) ? pc::infty
-                                           : -k_half * rmax_squared * std::log(1 - r_squared / rmax_squared);
-    };
+    energyFunc = [&](Geometry::DistanceFunction dist) { return energy(p.cbegin(), dist); };
 }
 
 FENEWCABond::FENEWCABond(double k, double rmax, double epsilon, double sigma, const std::vector<int> &index)
@@ -161,19 +164,22 @@ void FENEWCABond::to_json(Faunus::json &j) const {
 }
 
 std::string FENEWCABond::name() const { return "fene+wca"; }
+
+double FENEWCABond::energy(ParticleVector::const_iterator first, const Geometry::DistanceFunction &dist) const {
+    double r_squared = dist(first[index[0]].pos, first[index[1]].pos).squaredNorm();
+    double wca = 0;
+    double x = sigma_squared;
+    if (r_squared <= x * 1.2599210498948732) {
+        x = x / r_squared;
+        x = x * x * x;
+        wca = epsilon * (x * x - x + 0.25);
+    }
+    return (r_squared > rmax_squared) ? pc::infty
+                                      : -k_half * rmax_squared * std::log(1 - r_squared / rmax_squared) + wca;
+}
+
 void FENEWCABond::setEnergyFunction(const ParticleVector &p) {
-    energyFunc = [&](Geometry::DistanceFunction dist) {
-        double r_squared = dist(p[index[0]].pos, p[index[1]].pos).squaredNorm();
-        double wca = 0;
-        double x = sigma_squared;
-        if (r_squared <= x * 1.2599210498948732) {
-            x = x / r_squared;
-            x = x * x * x;
-            wca = epsilon * (x * x - x + 0.25);
-        }
-        return (r_squared > rmax_squared) ? pc::infty
-                                          : -k_half * rmax_squared * std::log(1 - r_squared / rmax_squared) + wca;
-    };
+    energyFunc = [&](Geometry::DistanceFunction dist) { return energy(p.cbegin(), dist); };
 }
 
 void HarmonicTorsion::from_json(const Faunus::json &j) {
@@ -195,13 +201,15 @@ std::string HarmonicTorsion::name() const { return "harmonic_torsion"; }
 
 std::shared_ptr<BondData> HarmonicTorsion::clone() const { return std::make_shared<HarmonicTorsion>(*this); }
 
+double HarmonicTorsion::energy(ParticleVector::const_iterator first, const Geometry::DistanceFunction &dist) const {
+    Point ray1 = dist(first[index[0]].pos, first[index[1]].pos);
+    Point ray2 = dist(first[index[2]].pos, first[index[1]].pos);
+    double angle = std::acos(ray1.dot(ray2) / ray1.norm() / ray2.norm());
+    return k_half * (angle - aeq) * (angle - aeq);
+}
+
 void HarmonicTorsion::setEnergyFunction(const ParticleVector &p) {
-    energyFunc = [&](Geometry::DistanceFunction dist) {
-        Point ray1 = dist(p[index[0]].pos, p[index[1]].pos);
-        Point ray2 = dist(p[index[2]].pos, p[index[1]].pos);
-        double angle = std::acos(ray1.dot(ray2) / ray1.norm() / ray2.norm());
-        return k_half * (angle - aeq) * (angle - aeq);
-    };
+    energyFunc = [&](Geometry::DistanceFunction dist) { return energy(p.cbegin(), dist); };
 }
 
 void GromosTorsion::from_json(const Faunus::json &j) {
@@ -222,13 +230,15 @@ std::string GromosTorsion::name() const { return "gromos_torsion"; }
 
 std::shared_ptr<BondData> GromosTorsion::clone() const { return std::make_shared<GromosTorsion>(*this); }
 
+double GromosTorsion::energy(ParticleVector::const_iterator first, const Geometry::DistanceFunction &dist) const {
+    Point ray1 = dist(first[index[0]].pos, first[index[1]].pos);
+    Point ray2 = dist(first[index[2]].pos, first[index[1]].pos);
+    double dcos = cos_aeq - ray1.dot(ray2) / (ray1.norm() * ray2.norm());
+    return k_half * dcos * dcos;
+}
+
 void GromosTorsion::setEnergyFunction(const ParticleVector &p) {
-    energyFunc = [&](Geometry::DistanceFunction dist) {
-        Point ray1 = dist(p[index[0]].pos, p[index[1]].pos);
-        Point ray2 = dist(p[index[2]].pos, p[index[1]].pos);
-        double dcos = cos_aeq - ray1.dot(ray2) / (ray1.norm() * ray2.norm());
-        return k_half * dcos * dcos;
-    };
+    energyFunc = [&](Geometry::DistanceFunction dist) { return energy(p.cbegin(), dist); };
 }
 
 int PeriodicDihedral::numindex() const { return 4; }
@@ -252,17 +262,19 @@ BondData::Variant PeriodicDihedral::type() const { return BondData::PERIODIC_DIH
 
 std::string PeriodicDihedral::name() const { return "periodic_dihedral"; }
 
+double PeriodicDihedral::energy(ParticleVector::const_iterator first, const Geometry::DistanceFunction &dist) const {
+    Point vec1 = dist(first[index[1]].pos, first[index[0]].pos);
+    Point vec2 = dist(first[index[2]].pos, first[index[1]].pos);
+    Point vec3 = dist(first[index[3]].pos, first[index[2]].pos);
+    Point norm1 = vec1.cross(vec2);
+    Point norm2 = vec2.cross(vec3);
+    // atan2( [v1×v2]×[v2×v3]⋅[v2/|v2|], [v1×v2]⋅[v2×v3] )
+    double angle = atan2((norm1.cross(norm2)).dot(vec2) / vec2.norm(), norm1.dot(norm2));
+    return k * (1 + cos(n * angle - phi));
+}
+
 void PeriodicDihedral::setEnergyFunction(const ParticleVector &p) {
-    energyFunc = [&](Geometry::DistanceFunction dist) {
-        Point vec1 = dist(p[index[1]].pos, p[index[0]].pos);
-        Point vec2 = dist(p[index[2]].pos, p[index[1]].pos);
-        Point vec3 = dist(p[index[3]].pos, p[index[2]].pos);
-        Point norm1 = vec1.cross(vec2);
-        Point norm2 = vec2.cross(vec3);
-        // atan2( [v1×v2]×[v2×v3]⋅[v2/|v2|], [v1×v2]⋅[v2×v3] )
-        double angle = atan2((norm1.cross(norm2)).dot(vec2) / vec2.norm(), norm1.dot(norm2));
-        return k * (1 + cos(n * angle - phi));
-    };
+    energyFunc = [&](Geometry::DistanceFunction dist) { return energy(p.cbegin(), dist); };
 }
 
 StretchData::StretchData(const std::vector<int> &index) : BondData(index) {}
@@ -38,6 +38,16 @@ struct BondData {
     virtual std::shared_ptr<BondData> clone() const = 0; //!< Make shared pointer *copy* of data
     bool hasEnergyFunction() const;                      //!< test if energy function has been set
     void shift(int offset);                              //!< Add offset to index
+
+    /**
+     * @brief Bond energy with `index` taken relative to `first`
+     *
+     * Unlike `energyFunc`, this requires neither a copy of the bond nor a particle vector reference and
+     * can be evaluated directly on the (relative) bond data of a molecule type, e.g. `molecules[id].bonds`,
+     * with `first` pointing to the first particle of a group.
+     */
+    virtual double energy(ParticleVector::const_iterator first, const Geometry::DistanceFunction &distance) const = 0;
+
     BondData() = default;
     BondData(const std::vector<int> &index);
     virtual ~BondData() = default;
@@ -67,6 +77,7 @@ struct HarmonicBond : public StretchData {
     void from_json(const json &j) override;
     void to_json(json &j) const override;
     std::string name() const override;
+    double energy(ParticleVector::const_iterator, const Geometry::DistanceFunction &) const override;
     void setEnergyFunction(const ParticleVector &); //!< Set energy and force functors
     HarmonicBond() = default;
     HarmonicBond(double k, double req, const std::vector<int> &index);
@@ -84,6 +95,7 @@ struct FENEBond : public StretchData {
     void from_json(const json &j) override;
     void to_json(json &j) const override;
     std::string name() const override;
+    double energy(ParticleVector::const_iterator, const Geometry::DistanceFunction &) const override;
     void setEnergyFunction(const ParticleVector &p);
     FENEBond() = default;
     FENEBond(double k, double rmax, const std::vector<int> &index);
@@ -100,6 +112,7 @@ struct FENEWCABond : public StretchData {
     void from_json(const json &j) override;
     void to_json(json &j) const override;
     std::string name() const override;
+    double energy(ParticleVector::const_iterator, const Geometry::DistanceFunction &) const override;
     void setEnergyFunction(const ParticleVector &p);
     FENEWCABond() = default;
     FENEWCABond(double k, double rmax, double epsilon, double sigma, const std::vector<int> &index);
@@ -117,6 +130,7 @@ struct HarmonicTorsion : public TorsionData {
     void to_json(json &j) const override;
     Variant type() const override;
     std::string name() const override;
+    double energy(ParticleVector::const_iterator, const Geometry::DistanceFunction &) const override;
     void setEnergyFunction(const ParticleVector &p);
     HarmonicTorsion() = default;
     HarmonicTorsion(double k, double aeq, const std::vector<int> &index);
@@ -134,6 +148,7 @@ struct GromosTorsion : public TorsionData {
     void to_json(json &j) const override;
     Variant type() const override;
     std::string name() const override;
+    double energy(ParticleVector::const_iterator, const Geometry::DistanceFunction &) const override;
     void setEnergyFunction(const ParticleVector &p);
     GromosTorsion() = default;
     GromosTorsion(double k, double cos_aeq, const std::vector<int> &index);
@@ -152,6 +167,7 @@ struct PeriodicDihedral : public BondData {
     void to_json(json &j) const override;
     Variant type() const override;
     std::string name() const override;
+    double energy(ParticleVector::const_iterator, const Geometry::DistanceFunction &) const override;
     void setEnergyFunction(const ParticleVector &p);
     PeriodicDihedral() = default;
     PeriodicDihedral(double k, double phi, double n, const std::vector<int> &index);
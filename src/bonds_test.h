@@ -32,6 +32,11 @@ TEST_CASE("[Faunus] BondData") {
             CHECK_EQ(bond.energyFunc(distance_3a), Approx(200));
             CHECK_EQ(bond.energyFunc(distance), Approx(50));
         }
+        SUBCASE("HarmonicBond Relative Index") {
+            HarmonicBond bond(100.0, 5.0, {0, 1});
+            CHECK_EQ(bond.energy(p_4a.cbegin(), distance), Approx(50));
+            CHECK_EQ(bond.energy(p_60deg_4a.cbegin() + 1, distance), Approx(50)); // particles 1 and 2
+        }
         SUBCASE("HarmonicBond Force") {
             HarmonicBond bond(100.0, 4, {0, 1});
             bond.setEnergyFunction(p_4a);
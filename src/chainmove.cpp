@@ -1,6 +1,8 @@
 #include "chainmove.h"
 #include "aux/iteratorsupport.h"
 #include "bonds.h"
+#include "energy.h"
+#include <numeric>
 
 namespace Faunus {
 namespace Move {
@@ -81,6 +83,7 @@ void ChainRotationMove::store_change(Change &change) {
         change_data.index = Faunus::distance(spc.groups.begin(), &chain); // integer *index* of moved group
         change_data.all = false;
         change_data.internal = true;          // trigger internal interactions
+        change_data.moved2moved = false;      // the segment is rotated rigidly
         change.groups.push_back(change_data); // add to list of moved groups
     }
 }
@@ -188,5 +191,195 @@ size_t PivotMove::select_segment() {
     return segment_size;
 }
 
+RegrowthMove::RegrowthMove(Space &spc, Energy::Hamiltonian &hamiltonian) : spc(spc) {
+    name = "regrowth";
+    cite = "doi:10.1080/00268979200100061";
+    repeat = -1;
+    for (const auto &energy : hamiltonian.find<Energy::NonbondedBase>()) {
+        nonbonded.push_back(energy);
+    }
+}
+
+void RegrowthMove::_from_json(const json &j) {
+    molname = j.at("molecule");
+    auto moliter = findName(molecules, molname);
+    if (moliter == molecules.end()) {
+        throw ConfigurationError("unknown molecule '" + molname + "'");
+    }
+    if (moliter->atomic || moliter->rigid) {
+        throw ConfigurationError("molecule '" + molname + "' must be flexible and non-atomic");
+    }
+    molid = moliter->id();
+    num_trials = j.value("trials", 10);
+    max_length = j.value("length", 1);
+    if (num_trials < 1 || max_length < 1) {
+        throw ConfigurationError("'trials' and 'length' must be positive");
+    }
+    if (repeat < 0) { // set the number of repetitions to the number of chains
+        auto mollist = spc.findMolecules(molid, Space::ALL);
+        repeat = std::distance(mollist.begin(), mollist.end());
+    }
+}
+
+void RegrowthMove::_to_json(json &j) const {
+    j = {{"molecule", molname}, {"trials", num_trials}, {"length", max_length}};
+    if (segment_length.cnt > 0) {
+        j["average length"] = segment_length.avg();
+        j[u8::rootof + u8::bracket("r" + u8::squared)] = std::sqrt(msqdispl.avg());
+    }
+    _roundjson(j, 3);
+}
+
+/**
+ * The segment has between one and `length` atoms, but always leaves at least one atom in place.
+ * Each bond is assigned to the growth step of its last regrown atom; bonds with no regrown atoms
+ * are left out as they do not change.
+ */
+void RegrowthMove::selectSegment() {
+    const int chain_size = chain->size();
+    const int length = slump.range(1, std::min(max_length, chain_size - 1));
+    tail = slump() > 0.5;
+    growth_order.resize(length);
+    bond_lengths.resize(length);
+    for (int step = 0; step < length; step++) {
+        const int index = tail ? chain_size - length + step : length - 1 - step;
+        growth_order[step] = index;
+        bond_lengths[step] = std::sqrt(spc.geo.sqdist((*chain)[index].pos, (*chain)[tail ? index - 1 : index + 1].pos));
+    }
+    std::vector<int> growth_step(chain_size, -1);
+    for (int step = 0; step < length; step++) {
+        growth_step[growth_order[step]] = step;
+    }
+    step_bonds.resize(length);
+    for (auto &bonds : step_bonds) {
+        bonds.clear();
+    }
+    for (const auto &bond : molecules[molid].bonds) {
+        int last_step = -1;
+        for (auto index : bond->index) {
+            last_step = std::max(last_step, growth_step.at(index));
+        }
+        if (last_step >= 0) {
+            step_bonds[last_step].push_back(bond);
+        }
+    }
+}
+
+void RegrowthMove::trialEnergies(size_t step) {
+    auto &group = *chain;
+    const int index = growth_order[step];
+    const int ignore_first = tail ? index + 1 : 0; // atoms not yet regrown
+    const int ignore_last = tail ? static_cast<int>(group.size()) : index;
+    trial_energies.assign(trial_positions.size(), 0.0);
+    for (const auto &energy : nonbonded) {
+        energy->particleEnergies(group, index, trial_positions, ignore_first, ignore_last, pair_energies);
+        std::transform(trial_energies.begin(), trial_energies.end(), pair_energies.begin(), trial_energies.begin(),
+                       std::plus<>());
+    }
+    if (!step_bonds[step].empty()) {
+        const auto distance = spc.geo.getDistanceFunc();
+        auto &particle = group[index];
+        const Point position = particle.pos;
+        for (size_t k = 0; k < trial_positions.size(); k++) {
+            particle.pos = trial_positions[k];
+            for (const auto &bond : step_bonds[step]) {
+                trial_energies[k] += bond->energy(group.begin(), distance);
+            }
+        }
+        particle.pos = position;
+    }
+}
+
+/**
+ * @param regrow  If false, the current positions are used as the first trials and are kept
+ * @param energy  Sum of the trial energies of the selected positions (kT)
+ * @return Logarithm of the Rosenbluth weight, or -infinity if all trial positions of an atom are forbidden
+ */
+double RegrowthMove::grow(bool regrow, double &energy) {
+    auto &group = *chain;
+    double ln_weight = 0.0;
+    energy = 0.0;
+    trial_positions.resize(num_trials);
+    for (size_t step = 0; step < growth_order.size(); step++) {
+        const int index = growth_order[step];
+        const Point &origin = group[tail ? index - 1 : index + 1].pos;
+        for (int k = 0; k < num_trials; k++) {
+            if (k == 0 && !regrow) {
+                trial_positions[k] = group[index].pos;
+            } else {
+                trial_positions[k] = origin + ranunit(slump) * bond_lengths[step];
+                spc.geo.boundary(trial_positions[k]);
+            }
+        }
+        trialEnergies(step);
+        const double min_energy = *std::min_element(trial_energies.begin(), trial_energies.end());
+        if (!std::isfinite(min_energy)) {
+            return -pc::infty;
+        }
+        boltzmann_factors.resize(num_trials); // relative to the lowest energy
+        std::transform(trial_energies.begin(), trial_energies.end(), boltzmann_factors.begin(),
+                       [min_energy](double trial_energy) { return std::exp(min_energy - trial_energy); });
+        const double sum = std::accumulate(boltzmann_factors.begin(), boltzmann_factors.end(), 0.0);
+        ln_weight += std::log(sum / num_trials) - min_energy;
+        int selected = 0;
+        if (regrow) {
+            double cumulative = boltzmann_factors[0];
+            const double threshold = slump() * sum;
+            while (cumulative <= threshold && selected < num_trials - 1) {
+                cumulative += boltzmann_factors[++selected];
+            }
+        }
+        energy += trial_energies[selected];
+        group[index].pos = trial_positions[selected];
+    }
+    return ln_weight;
+}
+
+void RegrowthMove::_move(Change &change) {
+    bias_energy = 0.0;
+    sqdispl = 0.0;
+    chain = spc.randomMolecule(molid, slump);
+    if (chain == spc.groups.end() || chain->size() < 2) {
+        return;
+    }
+    selectSegment();
+    PointVector old_positions(growth_order.size());
+    std::transform(growth_order.begin(), growth_order.end(), old_positions.begin(),
+                   [&](int index) { return (*chain)[index].pos; });
+
+    double old_energy, new_energy;
+    const double old_ln_weight = grow(false, old_energy);
+    const double new_ln_weight = grow(true, new_energy);
+    if (std::isfinite(old_ln_weight) && std::isfinite(new_ln_weight)) {
+        bias_energy = -(new_energy - old_energy) - (new_ln_weight - old_ln_weight);
+    } else {
+        bias_energy = pc::infty; // no allowed trial positions; reject
+    }
+    for (size_t step = 0; step < growth_order.size(); step++) {
+        sqdispl += spc.geo.sqdist(old_positions[step], (*chain)[growth_order[step]].pos);
+    }
+    sqdispl /= growth_order.size();
+    chain->cm = Geometry::massCenter(chain->begin(), chain->end(), spc.geo.getBoundaryFunc(), -chain->cm);
+
+    Change::data change_data;
+    change_data.index = Faunus::distance(spc.groups.begin(), chain); // integer *index* of moved group
+    change_data.atoms = growth_order;
+    std::sort(change_data.atoms.begin(), change_data.atoms.end()); // `atoms` index are relative to chain
+    change_data.internal = true;                                    // trigger internal interactions
+    change.groups.push_back(change_data);
+}
+
+void RegrowthMove::_accept(Change &) {
+    msqdispl += sqdispl;
+    segment_length += growth_order.size();
+}
+
+void RegrowthMove::_reject(Change &) {
+    msqdispl += 0.0;
+    segment_length += growth_order.size();
+}
+
+double RegrowthMove::bias(Change &, double, double) { return bias_energy; }
+
 } // end of namespace Move
 } // namespace Faunus
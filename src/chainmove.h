@@ -4,6 +4,11 @@
 #include "bonds.h"
 
 namespace Faunus {
+
+namespace Energy {
+class NonbondedBase;
+}
+
 namespace Move {
 /**
  * @brief An abstract base class for rotational movements of a polymer chain
@@ -129,5 +134,55 @@ class PivotMove : public ChainRotationMove {
     size_t select_segment() override;
 };
 
+/**
+ * @brief Configurational-bias regrowth of a terminal segment of a polymer chain.
+ *
+ * A random number of atoms at a random end of a random chain is regrown atom by atom, keeping the bond lengths.
+ * For each atom, `trials` positions are generated on a sphere around the preceding atom and one is selected with
+ * a probability proportional to its Boltzmann factor. The trial energies are the non-bonded energies with atoms not
+ * yet regrown left out, plus the bonded energies of bonds whose atoms are all in place. The old segment is
+ * "regrown" the same way, with its actual positions as the first trials, to give the Rosenbluth weights
+ * `W_new` and `W_old`. As the Hamiltonian evaluates the full energy change `ΔU`, the bias corrects for the
+ * approximate energies `U'` used for the trial positions, giving the acceptance probability
+ * `min(1, W_new / W_old exp(-ΔU + ΔU'))`.
+ *
+ * A non-branched chain with bonded atoms in a dense sequence is assumed.
+ */
+class RegrowthMove : public Movebase {
+  private:
+    Space &spc;
+    std::vector<std::shared_ptr<Energy::NonbondedBase>> nonbonded; //!< Non-bonded energies used for trial positions
+    std::string molname;
+    int molid = -1;
+    int num_trials = 10;                 //!< Number of trial positions per atom
+    int max_length = 1;                  //!< Maximum number of atoms to regrow
+    bool tail = true;                    //!< Regrow the end of the chain (or the beginning)
+    double bias_energy = 0.0;            //!< Rosenbluth weight ratio and trial energy correction (kT)
+    double sqdispl = 0.0;                //!< Mean squared displacement of regrown atoms
+    Average<double> msqdispl;            //!< Mean squared displacement of regrown atoms
+    Average<double> segment_length;      //!< Number of regrown atoms
+    Space::Tgvec::iterator chain;        //!< Chain to regrow
+    std::vector<int> growth_order;       //!< Regrown atoms relative to the chain, in order of growth
+    std::vector<double> bond_lengths;    //!< Distance to the preceding atom for each regrown atom
+    std::vector<std::vector<std::shared_ptr<Potential::BondData>>> step_bonds; //!< Bonds completed by each atom
+    PointVector trial_positions;
+    std::vector<double> trial_energies;
+    std::vector<double> pair_energies;
+    std::vector<double> boltzmann_factors;
+
+    void selectSegment();                      //!< Select segment and its bonds in a random chain
+    void trialEnergies(size_t step);           //!< Energies of the trial positions of a regrown atom
+    double grow(bool regrow, double &energy);  //!< Grow the segment; returns logarithm of Rosenbluth weight
+    void _move(Change &change) override;
+    void _accept(Change &change) override;
+    void _reject(Change &change) override;
+    void _from_json(const json &j) override;
+    void _to_json(json &j) const override;
+
+  public:
+    RegrowthMove(Space &spc, Energy::Hamiltonian &hamiltonian);
+    double bias(Change &, double uold, double unew) override;
+};
+
 } // namespace Move
 } // namespace Faunus
@@ -0,0 +1,118 @@
+#pragma once
+#include "chainmove.h"
+#include "montecarlo_test.h"
+
+namespace Faunus {
+
+TEST_SUITE_BEGIN("ChainMove");
+
+TEST_CASE("[Faunus] RegrowthMove") {
+    using doctest::Approx;
+    // ideal three-atom chains with a stiff 90 degree angle; k = 248 kJ/mol/rad^2 is about 100 kT
+    json input = R"({
+        "geometry": {"type": "cuboid", "length": 200},
+        "atomlist": [ {"A": {"sigma": 0.0}} ],
+        "moleculelist": [ {"chain": {
+            "structure": [ {"A": [0.0, 0.0, 0.0]}, {"A": [5.0, 0.0, 0.0]}, {"A": [5.0, 5.0, 0.0]} ],
+            "bondlist": [
+                {"harmonic": {"index": [0, 1], "k": 100, "req": 5.0}},
+                {"harmonic": {"index": [1, 2], "k": 100, "req": 5.0}},
+                {"harmonic_torsion": {"index": [0, 1, 2], "k": 248, "aeq": 90}}
+            ]
+        }} ],
+        "insertmolecules": [ {"chain": {"N": 50}} ],
+        "energy": [ {"bonded": {}} ],
+        "moves": [ {"regrowth": {"molecule": "chain", "length": 2, "trials": 10}} ]
+    })"_json;
+
+    Average<double> bond_length, energy;
+    Change change;
+    change.all = true;
+    runSimulation(input, 400, [&](MetropolisMonteCarlo &simulation) {
+        const auto &spc = simulation.getSpace();
+        for (const auto &chain : spc.groups) {
+            bond_length += std::sqrt(spc.geo.sqdist(chain[0].pos, chain[1].pos));
+            bond_length += std::sqrt(spc.geo.sqdist(chain[1].pos, chain[2].pos));
+        }
+        energy += simulation.getHamiltonian().energy(change) / static_cast<double>(spc.groups.size());
+    });
+    // bond lengths are kept, so only the angle is sampled: <U> = kT/2 for a stiff harmonic angle
+    CHECK(bond_length.avg() == Approx(5.0));
+    CHECK(energy.avg() == Approx(0.5).epsilon(0.1));
+}
+
+TEST_CASE("[Faunus] RegrowthMove - nonbonded") {
+    // trial positions are weighted by their non-bonded energy with the other chains and the rest of the chain
+    json input = R"({
+        "geometry": {"type": "cuboid", "length": 50},
+        "atomlist": [ {"A": {"sigma": 4.0, "eps": 0.5}} ],
+        "moleculelist": [ {"chain": {"excluded_neighbours": 1,
+            "structure": [ {"A": [0.0, 0.0, 0.0]}, {"A": [5.0, 0.0, 0.0]}, {"A": [10.0, 0.0, 0.0]},
+                           {"A": [15.0, 0.0, 0.0]} ],
+            "bondlist": [
+                {"harmonic": {"index": [0, 1], "k": 100, "req": 5.0}},
+                {"harmonic": {"index": [1, 2], "k": 100, "req": 5.0}},
+                {"harmonic": {"index": [2, 3], "k": 100, "req": 5.0}}
+            ]
+        }} ],
+        "insertmolecules": [ {"chain": {"N": 40}} ],
+        "energy": [ {"bonded": {}}, {"nonbonded": {"default": [ {"lennardjones": {"mixing": "LB"}} ]}} ],
+        "moves": [ {"regrowth": {"molecule": "chain", "length": 3, "trials": 10}} ]
+    })"_json;
+
+    Average<double> bond_length;
+    runSimulation(input, 100, [&](MetropolisMonteCarlo &simulation) {
+        const auto &spc = simulation.getSpace();
+        for (const auto &chain : spc.groups) {
+            bond_length += std::sqrt(spc.geo.sqdist(chain[2].pos, chain[3].pos));
+        }
+    });
+    CHECK(bond_length.avg() == doctest::Approx(5.0));
+}
+
+TEST_CASE("[Faunus] PivotMove") {
+    // pivot skips pairs within the rotated segment; the accumulated energy change must match a full evaluation
+    json input = R"({
+        "geometry": {"type": "cuboid", "length": 100},
+        "atomlist": [ {"ALA": {"sigma": 3.0, "eps": 0.5}} ],
+        "moleculelist": [ {"chain": {"excluded_neighbours": 2,
+            "structure": {"fasta": "AAAAAAAAAAAAAAAAAAAA", "k": 3, "req": 4}}} ],
+        "insertmolecules": [ {"chain": {"N": 2}} ],
+        "energy": [ {"bonded": {}}, {"nonbonded": {"default": [ {"lennardjones": {"mixing": "LB"}} ]}} ],
+        "moves": [ {"pivot": {"molecule": "chain", "dprot": 1.0}} ]
+    })"_json;
+
+    SUBCASE("Energy drift") { runSimulation(input, 100); }
+
+    SUBCASE("Single pivot") {
+        Faunus::atoms = input.at("atomlist").get<decltype(atoms)>();
+        Faunus::molecules = input.at("moleculelist").get<decltype(molecules)>();
+        Space spc, trial_spc;
+        from_json(input, spc);
+        Change everything;
+        everything.all = true;
+        trial_spc.sync(spc, everything);
+        Energy::Hamiltonian hamiltonian(spc, input.at("energy"));
+        Energy::Hamiltonian trial_hamiltonian(trial_spc, input.at("energy"));
+        hamiltonian.key = Energy::Energybase::ACCEPTED_MONTE_CARLO_STATE;
+        trial_hamiltonian.key = Energy::Energybase::TRIAL_MONTE_CARLO_STATE;
+        hamiltonian.init();
+        trial_hamiltonian.init();
+
+        Move::PivotMove pivot(trial_spc);
+        pivot.from_json(input.at("moves").at(0).at("pivot"));
+        Change change;
+        for (int attempt = 0; attempt < 100 && change.empty(); attempt++) {
+            pivot.move(change);
+        }
+        REQUIRE_FALSE(change.empty());
+        CHECK_FALSE(change.groups.front().moved2moved);
+        const double energy_change = trial_hamiltonian.energy(change) - hamiltonian.energy(change);
+        const double full_energy_change = trial_hamiltonian.energy(everything) - hamiltonian.energy(everything);
+        CHECK(energy_change == doctest::Approx(full_energy_change));
+    }
+}
+
+TEST_SUITE_END();
+
+} // namespace Faunus
@@ -2,6 +2,7 @@
 #include "penalty.h"
 #include "potentials.h"
 #include "externalpotential.h"
+#include <set>
 
 namespace Faunus {
 namespace Energy {
@@ -79,8 +80,10 @@ void PolicyIonIon::updateBox(EwaldData &d, const Point &box) const {
     if (k_vector_size == 0) {
         d.k_vectors.resize(3, 1);
         d.Aks.resize(1);
+        d.symmetry_factors.resize(1);
         d.k_vectors.col(0) = Point(1, 0, 0); // Just so it is not the zero-vector
         d.Aks[0] = 0;
+        d.symmetry_factors[0] = 0;
         d.num_kvectors = 1;
         d.Q_ion.resize(1);
         d.Q_dipole.resize(1);
@@ -88,6 +91,7 @@ void PolicyIonIon::updateBox(EwaldData &d, const Point &box) const {
         double nc2 = d.n_cutoff * d.n_cutoff;
         d.k_vectors.resize(3, k_vector_size);
         d.Aks.resize(k_vector_size);
+        d.symmetry_factors.resize(k_vector_size);
         d.num_kvectors = 0;
         d.k_vectors.setZero();
         d.Aks.setZero();
@@ -110,6 +114,7 @@ void PolicyIonIon::updateBox(EwaldData &d, const Point &box) const {
                     }
                     d.k_vectors.col(d.num_kvectors) = kv;
                     d.Aks[d.num_kvectors] = factor * exp(-k2 / (4 * d.alpha * d.alpha)) / k2;
+                    d.symmetry_factors[d.num_kvectors] = factor;
                     d.num_kvectors++;
                 }
             }
@@ -117,10 +122,34 @@ void PolicyIonIon::updateBox(EwaldData &d, const Point &box) const {
         d.Q_ion.resize(d.num_kvectors);
         d.Q_dipole.resize(d.num_kvectors);
         d.Aks.conservativeResize(d.num_kvectors);
+        d.symmetry_factors.conservativeResize(d.num_kvectors);
         d.k_vectors.conservativeResize(3, d.num_kvectors);
     }
 }
 
+/**
+ * If the box is scaled along with *all* particle positions, k·r and hence the
+ * structure factors, `Q_ion`, are invariant since the k-vectors scale inversely
+ * with the box. This is true for both PBC and IPBC schemes and for any scaling
+ * direction. Only the k-vectors and `Aks` need updating which is O(K) as opposed
+ * to O(NK) for `updateBox()` followed by `updateComplex()`.
+ *
+ * @param d Ewald data with k-vectors for the old box length
+ * @param box New box length
+ * @note The Yukawa zero-vector test depends on the box length and must use `updateBox()`
+ */
+void EwaldPolicyBase::scaleBox(EwaldData &d, const Point &box) const {
+    assert(d.kappa_squared == 0);
+    const Point scale = d.box_length.cwiseQuotient(box); // k ~ 1/L
+    d.k_vectors = scale.asDiagonal() * d.k_vectors;
+    d.box_length = box;
+    d.check_k2_zero = 0.1 * std::pow(2 * pc::pi / d.box_length.maxCoeff(), 2);
+    for (int k = 0; k < d.k_vectors.cols(); k++) {
+        double k2 = d.k_vectors.col(k).squaredNorm();
+        d.Aks[k] = d.symmetry_factors[k] * std::exp(-k2 / (4 * d.alpha * d.alpha)) / k2;
+    }
+}
+
 /**
  * @todo Add OpenMP pragma to first loop
  */
@@ -183,8 +212,10 @@ void PolicyIonIonIPBC::updateBox(EwaldData &data, const Point &box) const {
     if (k_vector_size == 0) {
         data.k_vectors.resize(3, 1);
         data.Aks.resize(1);
+        data.symmetry_factors.resize(1);
         data.k_vectors.col(0) = Point(1, 0, 0); // Just so it is not the zero-vector
         data.Aks[0] = 0;
+        data.symmetry_factors[0] = 0;
         data.num_kvectors = 1;
         data.Q_ion.resize(1);
         data.Q_dipole.resize(1);
@@ -192,6 +223,7 @@ void PolicyIonIonIPBC::updateBox(EwaldData &data, const Point &box) const {
         double nc2 = data.n_cutoff * data.n_cutoff;
         data.k_vectors.resize(3, k_vector_size);
         data.Aks.resize(k_vector_size);
+        data.symmetry_factors.resize(k_vector_size);
         data.num_kvectors = 0;
         data.k_vectors.setZero();
         data.Aks.setZero();
@@ -217,6 +249,7 @@ void PolicyIonIonIPBC::updateBox(EwaldData &data, const Point &box) const {
                     }
                     data.k_vectors.col(data.num_kvectors) = kv;
                     data.Aks[data.num_kvectors] = factor * exp(-k2 / (4 * data.alpha * data.alpha)) / k2;
+                    data.symmetry_factors[data.num_kvectors] = factor;
                     data.num_kvectors++;
                 }
             }
@@ -224,6 +257,7 @@ void PolicyIonIonIPBC::updateBox(EwaldData &data, const Point &box) const {
         data.Q_ion.resize(data.num_kvectors);
         data.Q_dipole.resize(data.num_kvectors);
         data.Aks.conservativeResize(data.num_kvectors);
+        data.symmetry_factors.conservativeResize(data.num_kvectors);
         data.k_vectors.conservativeResize(3, data.num_kvectors);
     }
 }
@@ -343,9 +377,19 @@ double PolicyIonIonEigen::reciprocalEnergy(const EwaldData &d) {
 
 Ewald::Ewald(const json &j, Space &spc) : data(j), spc(spc) {
     name = "ewald";
+    if (spc.geo.isSkewed()) { // k-vectors are generated from the box lengths only
+        throw ConfigurationError(name + ": triclinic cells with tilted vectors are unsupported");
+    }
     policy = EwaldPolicyBase::makePolicy(data.policy);
     citation_information = policy->cite;
     init();
+
+    // Positions are scaled along with the box for atomic and compressible groups, only
+    spc.scaleVolumeTriggers.push_back([&positions_scaled = positions_scaled](Space &space, double, double) {
+        positions_scaled = std::all_of(space.groups.begin(), space.groups.end(), [](const auto &group) {
+            return group.atomic or group.compressible or group.size() <= 1;
+        });
+    });
 }
 
 void Ewald::init() {
@@ -358,7 +402,9 @@ double Ewald::energy(Change &change) {
     if (change) {
         // If the state is NEW_MONTE_CARLO_STATE (trial state), then update all k-vectors
         if (key == TRIAL_MONTE_CARLO_STATE) {
-            if (change.all or change.dV) { // everything changes
+            if (change.dV and positions_scaled and data.kappa_squared == 0) { // k·r is invariant
+                policy->scaleBox(data, spc.geo.getLength());
+            } else if (change.all or change.dV) { // everything changes
                 policy->updateBox(data, spc.geo.getLength());
                 policy->updateComplex(data, spc.groups); // update all (expensive!)
             } else { // much cheaper partial update
@@ -367,6 +413,7 @@ double Ewald::energy(Change &change) {
                 policy->updateComplex(data, change, spc.groups, *old_groups);
               }
             }
+            positions_scaled = false;
         }
         // the selfEnergy() is omitted as this is added as a separate term in `Hamiltonian`
         // (The pair-potential is responsible for this)
@@ -381,33 +428,59 @@ double Ewald::energy(Change &change) {
  * Calculate forces from reciprocal space. Note that
  * the destination force vector will *not* be zeroed
  * before addition.
+ *
+ * The phase factors, e^{ik·r}, are evaluated once per particle and k-vector
+ * for blocks of particles as dense matrices, whereafter the sum over k-vectors
+ * is a matrix product. With `Z = (mu + iq) Q*`, the real part needed is
+ *
+ *     Re[e^{ik·r} Z] = mu (cos(k·r) Re Q + sin(k·r) Im Q) + q (cos(k·r) Im Q - sin(k·r) Re Q)
  */
 void Ewald::force(std::vector<Point> &forces) {
     assert(forces.size() == spc.p.size());
-    const double volume = spc.geo.getVolume();
+    constexpr Eigen::Index block_size = 512; // particles per block; limits buffer size to block_size x K
+    const double prefactor = -4.0 * pc::pi / spc.geo.getVolume() * data.bjerrum_length; // to kT/Angstrom^2
+    const auto num_particles = static_cast<Eigen::Index>(spc.p.size());
 
-    // Surface contribution
-    Point total_dipole_moment = {0.0, 0.0, 0.0};
-    for (auto &particle : spc.p) {
-        auto mu = particle.hasExtension() ? particle.getExt().mu * particle.getExt().mulen : Point(0, 0, 0);
-        total_dipole_moment += particle.pos * particle.charge + mu;
+    Eigen::VectorXcd Q = data.Q_ion;
+    if (data.Q_dipole.size() == Q.size()) {
+        Q += data.Q_dipole;
     }
+    const Eigen::RowVectorXd Q_real = Q.real().transpose(), Q_imag = Q.imag().transpose();
+    const Eigen::MatrixX3d weighted_k_vectors = (data.k_vectors * data.Aks.asDiagonal()).transpose(); // K x 3
 
-    auto force = forces.begin(); // iterator to force vector on first particle
-
-    for (auto &particle : spc.p) { // loop over particles
-        (*force) = total_dipole_moment * particle.charge / (2.0 * data.surface_dielectric_constant + 1.0);
-        double mu_scalar = particle.hasExtension() ? particle.getExt().mulen : 0.0;
-        std::complex<double> qmu(mu_scalar, particle.charge);
-        for (size_t i = 0; i < data.k_vectors.cols(); i++) { // loop over k vectors
-            std::complex<double> Q = data.Q_ion[i] + data.Q_dipole[i];
-            double k_dot_r = data.k_vectors.col(i).dot(particle.pos);
-            std::complex<double> expKri(std::cos(k_dot_r), std::sin(k_dot_r));
-            std::complex<double> repart = expKri * qmu * std::conj(Q);
-            (*force) += std::real(repart) * data.k_vectors.col(i) * data.Aks[i];
+    Point total_dipole_moment = {0.0, 0.0, 0.0};
+    Eigen::MatrixX3d positions;
+    for (Eigen::Index first = 0; first < num_particles; first += block_size) {
+        const auto rows = std::min(block_size, num_particles - first);
+        positions.resize(rows, 3);
+        for (Eigen::Index i = 0; i < rows; i++) {
+            const auto &particle = spc.p[first + i];
+            positions.row(i) = particle.pos.transpose();
+            auto mu = particle.hasExtension() ? particle.getExt().mu * particle.getExt().mulen : Point(0, 0, 0);
+            total_dipole_moment += particle.pos * particle.charge + mu;
+        }
+        cos_kr.noalias() = positions * data.k_vectors; // rows x K
+        sin_kr = cos_kr.array().sin();
+        cos_kr = cos_kr.array().cos();
+        const Eigen::MatrixX3d dipole_sum =
+            (cos_kr.array().rowwise() * Q_real.array() + sin_kr.array().rowwise() * Q_imag.array()).matrix() *
+            weighted_k_vectors;
+        const Eigen::MatrixX3d charge_sum =
+            (cos_kr.array().rowwise() * Q_imag.array() - sin_kr.array().rowwise() * Q_real.array()).matrix() *
+            weighted_k_vectors;
+        for (Eigen::Index i = 0; i < rows; i++) {
+            const auto &particle = spc.p[first + i];
+            double mu_scalar = particle.hasExtension() ? particle.getExt().mulen : 0.0;
+            forces[first + i] +=
+                prefactor * (mu_scalar * dipole_sum.row(i) + particle.charge * charge_sum.row(i)).transpose();
         }
-        (*force) *= -4.0 * pc::pi / volume * data.bjerrum_length; // to units of kT/Angstrom^2
-        force++;                                                  // advance to next force vector
+    }
+
+    // Surface contribution
+    auto force = forces.begin();
+    for (auto &particle : spc.p) {
+        (*force) += prefactor * total_dipole_moment * particle.charge / (2.0 * data.surface_dielectric_constant + 1.0);
+        force++;
     }
 }
 
@@ -417,6 +490,7 @@ void Ewald::force(std::vector<Point> &forces) {
 void Ewald::sync(Energybase *energybase_pointer, Change &change) {
     auto other = dynamic_cast<decltype(this)>(energybase_pointer);
     assert(other);
+    positions_scaled = false;
     if (other->key == ACCEPTED_MONTE_CARLO_STATE) {
         old_groups =
             &(other->spc
@@ -494,6 +568,19 @@ Isobaric::Isobaric(const json &j, Space &spc) : spc(spc) {
     }
 }
 
+/**
+ * @param ghost Group with particles stored outside Space
+ * @return infinity if any particle in the ghost group is outside the container, otherwise zero
+ */
+double ContainerOverlap::ghostEnergy(const Space::Tgroup &ghost) const {
+    for (auto &particle : ghost) {
+        if (spc.geo.collision(particle.pos)) {
+            return pc::infty;
+        }
+    }
+    return 0;
+}
+
 double Isobaric::energy(Change &change) {
     if (change.dV || change.all || change.dN) {
         size_t N = 0;
@@ -510,6 +597,11 @@ double Isobaric::energy(Change &change) {
     } else
         return 0;
 }
+/**
+ * A ghost group does not change the volume nor the number of particles in Space
+ */
+double Isobaric::ghostEnergy(const Space::Tgroup &) const { return 0; }
+
 void Isobaric::to_json(json &j) const {
     j["P/atm"] = P / 1.0_atm;
     j["P/mM"] = P / 1.0_millimolar;
@@ -625,6 +717,14 @@ double Bonded::energy(Change &change) {
     return energy;
 }
 
+/**
+ * Intra-molecular bonds of a ghost group are not part of the bond lists and as for
+ * an inserted molecular group only the inter-molecular bonds are summed.
+ */
+double Bonded::ghostEnergy(const Space::Tgroup &) const { return sum_energy(inter); }
+
+bool Bonded::hasIntermolecularBonds() const { return !inter.empty(); }
+
 /**
  * @param forces Target force vector for *all* particles in the system
  *
@@ -701,6 +801,36 @@ void Hamiltonian::force(PointVector &forces) {
     }
 }
 
+/**
+ * Common geometries are matched with a specialised minimum image, so that the tests of the boundary
+ * conditions are resolved at compile time and hoisted out of the pair loops. Other geometries test
+ * the boundary conditions at run time.
+ */
+template <typename TPairPotential, bool allow_anisotropic_pair_potential>
+void Hamiltonian::addNonbonded(const json &j, Space &spc) {
+    // only a single cutoff scheme so far
+    typedef GroupCutoff TCutoff;
+#ifdef _OPENMP
+    // ready for OMP enabled policies
+    constexpr bool parallel = false;
+#else
+    constexpr bool parallel = false;
+#endif
+    auto add = [&](auto boundary) {
+        typedef PairEnergy<TPairPotential, allow_anisotropic_pair_potential, decltype(boundary)> TPairEnergy;
+        emplace_back<Energy::Nonbonded<PairingPolicy<TPairEnergy, TCutoff, parallel>>>(j, spc, *this);
+    };
+    if (spc.geo.hasBoundary<Geometry::CuboidBoundary>()) {
+        add(Geometry::CuboidBoundary());
+    } else if (spc.geo.hasBoundary<Geometry::SlitBoundary>()) {
+        add(Geometry::SlitBoundary());
+    } else if (spc.geo.hasBoundary<Geometry::OpenBoundary>()) {
+        add(Geometry::OpenBoundary());
+    } else {
+        add(Geometry::RuntimeBoundary());
+    }
+}
+
 Hamiltonian::Hamiltonian(Space &spc, const json &j) {
     using namespace Potential;
 
@@ -719,42 +849,32 @@ Hamiltonian::Hamiltonian(Space &spc, const json &j) {
     if (spc.geo.type not_eq Geometry::CUBOID)
         emplace_back<Energy::ContainerOverlap>(spc);
 
-    // only a single cutoff scheme so far
-    typedef GroupCutoff TCutoff;
-#ifdef _OPENMP
-    // ready for OMP enabled policies
-    constexpr bool parallel = false;
-#else
-    constexpr bool parallel = false;
-#endif
     for (auto &m : j) { // loop over energy list
         size_t oldsize = vec.size();
         for (auto it : m.items()) {
             try {
                 if (it.key() == "nonbonded_coulomblj" || it.key() == "nonbonded_newcoulomblj")
-                    emplace_back<Energy::Nonbonded<PairingPolicy<PairEnergy<CoulombLJ, false>, TCutoff, parallel>>>(it.value(), spc, *this);
+                    addNonbonded<CoulombLJ, false>(it.value(), spc);
                 else if (it.key() == "nonbonded_coulomblj_EM")
                     emplace_back<Energy::NonbondedCached<CoulombLJ>>(it.value(), spc, *this);
 
                 else if (it.key() == "nonbonded_splined")
-                    emplace_back<
-                        Energy::Nonbonded<PairingPolicy<PairEnergy<SplinedPotential, false>, TCutoff, parallel>>>(
-                        it.value(), spc, *this);
+                    addNonbonded<SplinedPotential, false>(it.value(), spc);
 
                 else if (it.key() == "nonbonded" or it.key() == "nonbonded_exact")
-                    emplace_back<Energy::Nonbonded<PairingPolicy<PairEnergy<FunctorPotential, true>, TCutoff, parallel>>>(it.value(), spc, *this);
+                    addNonbonded<FunctorPotential, true>(it.value(), spc);
 
                 else if (it.key() == "nonbonded_cached")
                     emplace_back<Energy::NonbondedCached<SplinedPotential>>(it.value(), spc, *this);
 
                 else if (it.key() == "nonbonded_coulombwca")
-                    emplace_back<Energy::Nonbonded<PairingPolicy<PairEnergy<CoulombWCA, false>, TCutoff, parallel>>>(it.value(), spc, *this);
+                    addNonbonded<CoulombWCA, false>(it.value(), spc);
 
                 else if (it.key() == "nonbonded_pm" or it.key() == "nonbonded_coulombhs")
-                    emplace_back<Energy::Nonbonded<PairingPolicy<PairEnergy<PrimitiveModel, false>, TCutoff, parallel>>>(it.value(), spc, *this);
+                    addNonbonded<PrimitiveModel, false>(it.value(), spc);
 
                 else if (it.key() == "nonbonded_pmwca")
-                    emplace_back<Energy::Nonbonded<PairingPolicy<PairEnergy<PrimitiveModelWCA, false>, TCutoff, parallel>>>(it.value(), spc, *this);
+                    addNonbonded<PrimitiveModelWCA, false>(it.value(), spc);
 
                 // this should be moved into `Nonbonded` and added when appropriate
                 // Nonbonded now has access to Hamiltonian (*this) and can therefore
@@ -799,6 +919,11 @@ Hamiltonian::Hamiltonian(Space &spc, const json &j) {
                     continue;
                 }
 
+                else if (it.key() == "adaptive_order") {
+                    adaptive_order_interval = it.value().get<unsigned int>();
+                    continue;
+                }
+
                 if (vec.size() == oldsize)
                     throw std::runtime_error("unknown term");
 
@@ -814,6 +939,9 @@ Hamiltonian::Hamiltonian(Space &spc, const json &j) {
             faunus_logger->warn(a.name + " bonds specified in topology but missing in energy");
 }
 double Hamiltonian::energy(Change &change) {
+    if (adaptive_order_interval > 0) {
+        return energyAdaptiveOrder(change);
+    }
     double du = 0;
     for (auto i : this->vec) { // loop over terms in Hamiltonian
         i->key = key;
@@ -825,6 +953,88 @@ double Hamiltonian::energy(Change &change) {
     }
     return du;
 }
+/**
+ * Cheap terms that often reach `maxenergy` (e.g. overlap checks returning infinity) are
+ * evaluated first so that the remaining terms can be skipped. The energies are summed in
+ * input order and hence the result is identical to `energy()` unless `maxenergy` is reached.
+ * Every `adaptive_order_interval` calls, the order is re-tuned from the per-term timers
+ * and trigger counts.
+ */
+double Hamiltonian::energyAdaptiveOrder(Change &change) {
+    if (evaluation_order.size() != vec.size()) { // first call: start from input order
+        evaluation_order.resize(vec.size());
+        std::iota(evaluation_order.begin(), evaluation_order.end(), 0);
+        term_energies.resize(vec.size());
+        trigger_counts.assign(vec.size(), 0);
+    }
+    std::fill(term_energies.begin(), term_energies.end(), 0.0);
+    double partial_sum = 0.0;
+    for (auto index : evaluation_order) {
+        auto &term = vec[index];
+        term->key = key;
+        term->timer.start();
+        term_energies[index] = term->energy(change);
+        term->timer.stop();
+        if (term_energies[index] >= maxenergy) {
+            trigger_counts[index]++;
+        }
+        partial_sum += term_energies[index];
+        if (partial_sum >= maxenergy) {
+            break; // stop summing energies
+        }
+    }
+    if (++num_energy_calls % adaptive_order_interval == 0) {
+        updateEvaluationOrder();
+    }
+    return std::accumulate(term_energies.begin(), term_energies.end(), 0.0);
+}
+
+/**
+ * For independent terms with evaluation cost `c` and probability `p` of reaching `maxenergy`,
+ * the expected cost is minimized by ascending `c/p`. Terms that never triggered are placed
+ * last, in input order.
+ */
+void Hamiltonian::updateEvaluationOrder() {
+    std::vector<double> cost_per_trigger(vec.size(), pc::infty);
+    for (size_t i = 0; i < vec.size(); i++) {
+        const auto calls = vec[i]->timer.calls();
+        if (calls > 0 && trigger_counts[i] > 0) {
+            const double cost = vec[i]->timer.seconds() / calls;
+            const double probability = double(trigger_counts[i]) / calls;
+            cost_per_trigger[i] = cost / probability;
+        }
+    }
+    std::iota(evaluation_order.begin(), evaluation_order.end(), 0);
+    std::stable_sort(evaluation_order.begin(), evaluation_order.end(),
+                     [&](auto a, auto b) { return cost_per_trigger[a] < cost_per_trigger[b]; });
+    if (faunus_logger->should_log(spdlog::level::trace)) {
+        std::string names;
+        for (auto i : evaluation_order) {
+            names += vec[i]->name + " ";
+        }
+        faunus_logger->trace("{}: evaluation order {}", name, names);
+    }
+}
+
+/**
+ * Unlike `energy()`, the terms are not timed nor is the state `key` touched, allowing
+ * concurrent calls from several threads as long as all terms are thread-safe.
+ *
+ * @param ghost Group with particles stored outside Space, e.g. a test particle
+ * @return Sum of all energy terms between the ghost group and Space
+ * @throw std::logic_error if any of the energy terms cannot handle ghost groups
+ */
+double Hamiltonian::ghostEnergy(const Space::Tgroup &ghost) const {
+    double u = 0;
+    for (auto &energy_term : this->vec) {
+        u += energy_term->ghostEnergy(ghost);
+        if (u >= maxenergy) {
+            break;
+        }
+    }
+    return u;
+}
+
 void Hamiltonian::init() {
     for (auto i : this->vec)
         i->init();
@@ -945,6 +1155,49 @@ void SASAEnergy::to_json(json &j) const {
 
 GroupCutoff::GroupCutoff(Space::Tgeometry &geometry) : geometry(geometry) {}
 
+double GroupCutoff::getCutoff(int molid1, int molid2) const {
+    const auto squared_cutoff = cutoff_squared(molid1, molid2);
+    return squared_cutoff < pc::max_value ? std::sqrt(squared_cutoff) : pc::infty;
+}
+
+/**
+ * Scans the pair potentials of a non-bonded energy for the distance beyond which they vanish. This is
+ * the `cutoff` of, e.g., `custom` and truncated `coulomb` schemes, including the real-space part of
+ * Ewald summation, and `rc + wc` for `cos2`. Contact potentials are ignored.
+ *
+ * @param j Input of the non-bonded energy
+ * @param unbounded Names of pair potentials without a finite range are appended here
+ * @return Largest finite cutoff; zero if none
+ */
+static double largestPairPotentialCutoff(const json &j, std::vector<std::string> &unbounded) {
+    const std::set<std::string> contact_potentials = {"hardsphere", "hertz", "sasa", "squarewell", "wca"};
+    double largest_cutoff = 0.0;
+    for (const auto &[key, potentials] : j.items()) { // "default" and custom atom pairs
+        if (!potentials.is_array()) {
+            continue;
+        }
+        for (const auto &potential : potentials) {
+            if (!potential.is_object()) {
+                continue;
+            }
+            for (const auto &[name, parameters] : potential.items()) {
+                const auto type = parameters.value("type", std::string());
+                const bool always_infinite = name == "coulomb" && (type == "plain" || (type == "yukawa" &&
+                                                                                      !parameters.value("shift", true)));
+                if (name == "cos2") {
+                    largest_cutoff = std::max(largest_cutoff, parameters.at("rc").get<double>() +
+                                                                  parameters.at("wc").get<double>());
+                } else if (parameters.contains("cutoff") && !always_infinite) {
+                    largest_cutoff = std::max(largest_cutoff, parameters.at("cutoff").get<double>());
+                } else if (contact_potentials.count(name) == 0) {
+                    unbounded.push_back(name);
+                }
+            }
+        }
+    }
+    return largest_cutoff;
+}
+
 void from_json(const json &j, GroupCutoff &cutoff) {
     // disable all group-to-group cutoffs by setting infinity
     for (auto &i : Faunus::molecules) {
@@ -989,6 +1242,47 @@ void from_json(const json &j, GroupCutoff &cutoff) {
             }
         }
     }
+
+    cutoff.pair_cutoff = j.value("cutoff_pair", 0.0);
+    if (cutoff.pair_cutoff < 0.0) {
+        throw ConfigurationError("cutoff_pair must be positive");
+    }
+    std::vector<std::string> unbounded;
+    cutoff.pair_potential_cutoff = largestPairPotentialCutoff(j, unbounded);
+    if (cutoff.pair_cutoff > 0.0) {
+        if (cutoff.pair_potential_cutoff > cutoff.pair_cutoff) {
+            throw ConfigurationError(fmt::format("cutoff_pair ({}) is shorter than a pair potential cutoff ({})",
+                                                 cutoff.pair_cutoff, cutoff.pair_potential_cutoff));
+        }
+        if (!unbounded.empty()) {
+            faunus_logger->warn("cutoff_pair truncates pair potentials without a finite range: {}",
+                                json(unbounded).dump());
+        }
+    }
+    if (cutoff.pair_cutoff > 0.0) { // rigid molecules are beyond reach if their bounding spheres are
+        for (auto &i : Faunus::molecules) {
+            for (auto &j : Faunus::molecules) {
+                const double reach = cutoff.pair_cutoff + boundingRadius(i) + boundingRadius(j);
+                if (reach < pc::infty && reach * reach < cutoff.cutoff_squared(i.id(), j.id())) {
+                    cutoff.cutoff_squared.set(i.id(), j.id(), reach * reach);
+                }
+            }
+        }
+    }
+}
+
+double boundingRadius(const MoleculeData &molecule) {
+    if (molecule.atomic || !molecule.rigid || molecule.conformations.empty()) {
+        return pc::infty;
+    }
+    double radius_squared = 0.0;
+    for (const auto &conformation : molecule.conformations.data) {
+        const Point mass_center = Geometry::massCenter(conformation.begin(), conformation.end());
+        for (const auto &particle : conformation) {
+            radius_squared = std::max(radius_squared, (particle.pos - mass_center).squaredNorm());
+        }
+    }
+    return std::sqrt(radius_squared);
 }
 
 void to_json(json &j, const GroupCutoff &cutoff) {
@@ -1008,6 +1302,105 @@ void to_json(json &j, const GroupCutoff &cutoff) {
     if (not _j.empty()) {
         j["cutoff_g2g"] = _j;
     }
+    if (cutoff.pair_cutoff > 0.0) {
+        j["cutoff_pair"] = cutoff.pair_cutoff;
+    }
+    if (cutoff.total_cnt > 0) {
+        j["cutoff_g2g skipped"] = cutoff.skip_cnt / cutoff.total_cnt; // fraction of group pairs beyond cutoff
+    }
+}
+
+//==================== AtomicCellList ====================
+
+AtomicCellList::AtomicCellList(double min_cell_length) : min_cell_length(min_cell_length) {}
+
+Eigen::Vector3i AtomicCellList::cellCoordinates(const Point &position) const {
+    Eigen::Vector3i coordinates;
+    for (int k = 0; k < 3; ++k) {
+        const int coordinate = static_cast<int>(std::floor((position[k] + 0.5 * box_length[k]) / cell_length[k]));
+        coordinates[k] = std::clamp(coordinate, 0, num_cells[k] - 1);
+    }
+    return coordinates;
+}
+
+int AtomicCellList::cellIndex(const Eigen::Vector3i &coordinates) const {
+    return coordinates.x() + num_cells.x() * (coordinates.y() + num_cells.y() * coordinates.z());
+}
+
+void AtomicCellList::moveParticle(int particle_index, const Point &position) {
+    const int cell = cellIndex(cellCoordinates(position));
+    auto &old_cell = particle_cell[particle_index];
+    if (old_cell != cell) {
+        if (old_cell >= 0) {
+            auto &particles = cells[old_cell];
+            auto it = std::find(particles.begin(), particles.end(), particle_index);
+            assert(it != particles.end());
+            *it = particles.back();
+            particles.pop_back();
+        }
+        cells[cell].push_back(particle_index);
+        old_cell = cell;
+    }
+}
+
+/**
+ * Dimensions with fewer than three cells are covered by a single cell to avoid visiting cells twice.
+ */
+void AtomicCellList::build(const Space &spc) {
+    if (min_cell_length <= 0.0) {
+        return;
+    }
+    box_length = spc.geo.getLength();
+    for (int k = 0; k < 3; ++k) {
+        num_cells[k] = static_cast<int>(box_length[k] / min_cell_length);
+        if (num_cells[k] < 3) {
+            num_cells[k] = 1;
+        }
+    }
+    cell_length = box_length.cwiseQuotient(num_cells.cast<double>());
+    cells.assign(num_cells.prod(), std::vector<int>());
+    particle_cell.assign(spc.p.size(), -1);
+    for (const auto &group : spc.groups) {
+        if (group.atomic) {
+            const auto offset = std::distance(spc.p.cbegin(), ParticleVector::const_iterator(group.begin()));
+            for (size_t i = 0; i < group.size(); ++i) {
+                moveParticle(offset + i, group[i].pos);
+            }
+        }
+    }
+    built = true;
+}
+
+/**
+ * Only particles in atomic groups enumerated in the change are rebinned. The list is rebuilt if everything
+ * changed, the volume or number of particles changed, or if the box differs from when the list was built.
+ */
+void AtomicCellList::update(const Space &spc, const Change &change) {
+    if (min_cell_length <= 0.0) {
+        return;
+    }
+    if (!built || change.all || change.dV || change.dN || particle_cell.size() != spc.p.size() ||
+        box_length != spc.geo.getLength()) {
+        build(spc);
+        return;
+    }
+    for (const auto &change_data : change.groups) {
+        const auto &group = spc.groups.at(change_data.index);
+        if (group.atomic) {
+            const auto offset = std::distance(spc.p.cbegin(), ParticleVector::const_iterator(group.begin()));
+            if (change_data.all || change_data.atoms.empty()) {
+                for (size_t i = 0; i < group.size(); ++i) {
+                    moveParticle(offset + i, group[i].pos);
+                }
+            } else {
+                for (auto i : change_data.atoms) {
+                    if (i < static_cast<int>(group.size())) {
+                        moveParticle(offset + i, group[i].pos);
+                    }
+                }
+            }
+        }
+    }
 }
 
 } // end of namespace Energy
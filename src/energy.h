@@ -6,6 +6,7 @@
 #include "aux/iteratorsupport.h"
 #include <range/v3/view.hpp>
 #include <Eigen/Dense>
+#include <unordered_map>
 #include "spdlog/spdlog.h"
 
 #ifdef ENABLE_FREESASA
@@ -55,6 +56,7 @@ struct ContainerOverlap : public Energybase {
     const Space &spc;
     ContainerOverlap(const Space &spc) : spc(spc) { name = "ContainerOverlap"; }
     double energy(Change &change) override;
+    double ghostEnergy(const Space::Tgroup &ghost) const override;
 };
 
 /**
@@ -72,6 +74,7 @@ struct EwaldData {
     typedef std::complex<double> Tcomplex;
     Eigen::Matrix3Xd k_vectors;             //!< k-vectors, 3xK
     Eigen::VectorXd Aks;                    //!< 1xK for update optimization (see Eq.24, DOI:10.1063/1.481216)
+    Eigen::VectorXd symmetry_factors;       //!< 1xK symmetry factors included in `Aks`
     Eigen::VectorXcd Q_ion, Q_dipole;       //!< Complex 1xK vectors
     double r_cutoff = 0;                    //!< Real-space cutoff
     double n_cutoff = 0;                    //!< Inverse space cutoff
@@ -117,6 +120,7 @@ class EwaldPolicyBase {
     virtual double surfaceEnergy(const EwaldData &, Change &,
                                  Space::Tgvec &) = 0;       //!< Surface energy contribution due to a change
     virtual double reciprocalEnergy(const EwaldData &) = 0; //!< Total reciprocal energy
+    void scaleBox(EwaldData &, const Point &) const; //!< Rescale k-vectors when all positions were scaled
 
     /**
      * @brief Represent charges and positions using an Eigen facade (Map)
@@ -196,6 +200,8 @@ class Ewald : public Energybase {
     std::shared_ptr<EwaldPolicyBase> policy; //!< Policy for updating k-space
     Space &spc;
     Space::Tgvec *old_groups = nullptr;
+    bool positions_scaled = false; //!< True if all positions were scaled with the box since last update
+    Eigen::MatrixXd cos_kr, sin_kr; //!< Reusable cos(k·r) and sin(k·r) for a block of particles (force calc.)
 
   public:
     Ewald(const json &, Space &);
@@ -215,6 +221,7 @@ class Isobaric : public Energybase {
   public:
     Isobaric(const json &, Space &);
     double energy(Change &) override;
+    double ghostEnergy(const Space::Tgroup &) const override;
     void to_json(json &) const override;
 };
 
@@ -259,7 +266,9 @@ class Bonded : public Energybase {
     Bonded(const json &, Space &);
     void to_json(json &) const override;
     double energy(Change &) override;          //!< brute force -- refine this!
+    double ghostEnergy(const Space::Tgroup &) const override;
     void force(std::vector<Point> &) override; //!< Calculates the forces on all particles
+    bool hasIntermolecularBonds() const;       //!< True if any bond connects different molecules
 };
 
 /**
@@ -285,11 +294,17 @@ template <typename TSize, typename TSet> inline auto indexComplement(const TSize
  * The distance between centers of mass is considered. The cutoff distance can be specified independently for each
  * group pair to override the default value.
  *
+ * If a pair cutoff is given beyond which all pair potentials vanish, the group cutoffs between rigid molecules are
+ * tightened to the pair cutoff plus the bounding radii of the two molecules. As rigid molecules change only by
+ * translation and rotation, the bounding radius is a constant of the molecule type, taken over all conformations.
+ *
  * @see PairEnergy
  */
 class GroupCutoff {
     double default_cutoff_squared = pc::max_value;
     PairMatrix<double> cutoff_squared;  //!< matrix with group-to-group cutoff distances squared in angstrom squared
+    double pair_cutoff = 0.0;           //!< distance beyond which all pair potentials vanish; zero if unknown
+    double pair_potential_cutoff = 0.0; //!< largest explicit cutoff of the pair potentials; zero if none
     double total_cnt = 0, skip_cnt = 0; //!< statistics
     Space::Tgeometry &geometry;         //!< geometry to compute the inter group distance with
     friend void from_json(const json&, GroupCutoff &);
@@ -303,20 +318,52 @@ class GroupCutoff {
     template <typename TGroup> inline bool cut(const TGroup &group1, const TGroup &group2) {
         bool result = false;
         ++total_cnt;
-        if (!group1.atomic && !group2.atomic // atomic groups have no meaningful cm
-            && geometry.sqdist(group1.cm, group2.cm) >= cutoff_squared(group1.id, group2.id)) {
+        if (isBeyondCutoff(group1, group2)) {
             result = true;
             ++skip_cnt;
         }
         return result;
     }
 
+    /**
+     * @brief Same as cut() but without updating the statistics, hence safe for concurrent use.
+     * @return true if the group-to-group distance is beyond the cutoff distance, false otherwise
+     */
+    template <typename TGroup> inline bool isBeyondCutoff(const TGroup &group1, const TGroup &group2) const {
+        return !group1.atomic && !group2.atomic // atomic groups have no meaningful cm
+               && geometry.sqdist(group1.cm, group2.cm) >= cutoff_squared(group1.id, group2.id);
+    }
+
+    /**
+     * @brief Determines if a single particle is beyond the cutoff distance from the mass center of a group.
+     *
+     * Thread-safe like isBeyondCutoff(). Used for trial positions of a particle before its group mass center is
+     * updated.
+     *
+     * @param position  particle position
+     * @param molid  molecule id of the particle's group
+     * @param group  other group
+     * @return true if the particle-to-group distance is beyond the group cutoff distance, false otherwise
+     */
+    template <typename TGroup> inline bool isBeyondCutoff(const Point &position, int molid, const TGroup &group) const {
+        return !group.atomic && geometry.sqdist(position, group.cm) >= cutoff_squared(molid, group.id);
+    }
+
     /**
      * @brief A functor alias for cut().
      * @see cut()
      */
     template <typename... Args> inline auto operator()(Args &&... args) { return cut(std::forward<Args>(args)...); }
 
+    /**
+     * @brief Cutoff distance between two molecule types
+     * @return cutoff distance (Å) or infinity if no cutoff is set
+     */
+    double getCutoff(int molid1, int molid2) const;
+
+    double getPairCutoff() const { return pair_cutoff; } //!< Pair cutoff distance (Å); zero if unknown
+    double getPairPotentialCutoff() const { return pair_potential_cutoff; } //!< Largest pair potential cutoff (Å)
+
     /**
      * @brief Sets the geometry.
      * @param geometry  geometry to compute the inter group distance with
@@ -327,13 +374,78 @@ class GroupCutoff {
 void from_json(const json&, GroupCutoff &);
 void to_json(json&, const GroupCutoff &);
 
+/**
+ * @brief Bounding radius of a rigid molecule
+ * @return Largest distance of an atom from the mass center over all conformations; infinity if not rigid
+ */
+double boundingRadius(const MoleculeData &);
+
+/**
+ * @brief Cell list of the active particles in atomic groups
+ *
+ * Lets the pairing policies visit only particles in atomic groups in the 27 cells surrounding a position. As the
+ * cells are at least as long as the pair cutoff, all particles within the cutoff are visited. Requires a cuboid or
+ * slit geometry; periodicity is assumed in all directions which in a slit merely adds particles beyond the cutoff.
+ *
+ * The list must be kept in sync with the particle positions, see update().
+ */
+class AtomicCellList {
+    double min_cell_length = 0.0;          //!< smallest allowed cell length; the list is disabled if zero
+    bool built = false;                    //!< true once built
+    Point box_length = {0, 0, 0};          //!< box side lengths when the list was built
+    Point cell_length = {0, 0, 0};         //!< cell side lengths
+    Eigen::Vector3i num_cells = {0, 0, 0}; //!< number of cells in each dimension
+    std::vector<std::vector<int>> cells;   //!< absolute indices of particles in each cell
+    std::vector<int> particle_cell;        //!< cell of each particle in space; -1 if not listed
+
+    Eigen::Vector3i cellCoordinates(const Point &position) const;
+    int cellIndex(const Eigen::Vector3i &coordinates) const;
+    void moveParticle(int particle_index, const Point &position); //!< Move particle to the cell at position
+
+  public:
+    explicit AtomicCellList(double min_cell_length = 0.0);
+    bool isBuilt() const { return built; }
+    void build(const Space &);                  //!< Rebuild from scratch
+    void update(const Space &, const Change &); //!< Rebin particles in changed atomic groups or rebuild if needed
+
+    /**
+     * @brief Call a function for all listed particles in the cells surrounding a position
+     * @param position  position to search around
+     * @param function  called with the absolute index of each particle
+     */
+    template <typename TFunction> void forEachNeighbour(const Point &position, TFunction function) const {
+        const Eigen::Vector3i center = cellCoordinates(position);
+        Eigen::Vector3i first, last;
+        for (int k = 0; k < 3; ++k) { // fewer than three cells in a dimension are merged into one
+            first[k] = num_cells[k] > 1 ? -1 : 0;
+            last[k] = num_cells[k] > 1 ? 1 : 0;
+        }
+        Eigen::Vector3i cell;
+        for (int dz = first.z(); dz <= last.z(); ++dz) {
+            cell.z() = (center.z() + dz + num_cells.z()) % num_cells.z();
+            for (int dy = first.y(); dy <= last.y(); ++dy) {
+                cell.y() = (center.y() + dy + num_cells.y()) % num_cells.y();
+                for (int dx = first.x(); dx <= last.x(); ++dx) {
+                    cell.x() = (center.x() + dx + num_cells.x()) % num_cells.x();
+                    for (auto particle_index : cells[cellIndex(cell)]) {
+                        function(particle_index);
+                    }
+                }
+            }
+        }
+    }
+};
+
 /**
  * @brief Provides a fast inlineable interface for non-bonded pair potential energy computation.
  *
  * @tparam TPairPotential  a pair potential to compute with
  * @tparam allow_anisotropic_pair_potential  pass also a distance vector to the pair potential, slower
+ * @tparam TBoundary  boundary conditions of the geometry if known at compile time, see Geometry::OrthogonalBoundary
  */
-template <typename TPairPotential, bool allow_anisotropic_pair_potential = true> class PairEnergy {
+template <typename TPairPotential, bool allow_anisotropic_pair_potential = true,
+          typename TBoundary = Geometry::RuntimeBoundary>
+class PairEnergy {
     Space::Tgeometry &geometry;                //!< geometry to operate with
     TPairPotential pair_potential;             //!< pair potential function/functor
     Space &spc;                                //!< space to init ParticleSelfEnergy with @see addPairPotentialSelfEnergy
@@ -343,7 +455,13 @@ template <typename TPairPotential, bool allow_anisotropic_pair_potential = true>
      * @param spc
      * @param potentials  registered non-bonded potentials
      */
-    PairEnergy(Space &spc, BasePointerVector<Energybase> &potentials) : geometry(spc.geo), spc(spc), potentials(potentials) {}
+    PairEnergy(Space &spc, BasePointerVector<Energybase> &potentials) : geometry(spc.geo), spc(spc), potentials(potentials) {
+        if (!geometry.hasBoundary<TBoundary>()) {
+            throw std::logic_error("pair energy specialised for another geometry");
+        }
+    }
+
+    bool isThreadSafe() const { return pair_potential.thread_safe; } //!< @see PairPotentialBase::thread_safe
 
     /**
      * @brief Computes pair potential energy.
@@ -355,17 +473,17 @@ template <typename TPairPotential, bool allow_anisotropic_pair_potential = true>
     template <typename T> inline double potential(const T &a, const T &b) const {
         assert(&a != &b); // a and b cannot be the same particle
         if constexpr (allow_anisotropic_pair_potential) {
-            const Point r = geometry.vdist(a.pos, b.pos);
+            const Point r = geometry.vdist<TBoundary>(a.pos, b.pos);
             return pair_potential(a, b, r.squaredNorm(), r);
         } else {
-            return pair_potential(a, b, geometry.sqdist(a.pos, b.pos), {0, 0, 0});
+            return pair_potential(a, b, geometry.sqdist<TBoundary>(a.pos, b.pos), {0, 0, 0});
         }
     }
 
     // just a temporary placement until PairForce class template will be implemented
     template <typename T> inline Point force(const T &a, const T &b) const {
         assert(&a != &b); // a and b cannot be the same particle
-        const Point r = geometry.vdist(a.pos, b.pos);
+        const Point r = geometry.vdist<TBoundary>(a.pos, b.pos);
         return pair_potential.force(a, b, r.squaredNorm(), r);
     }
 
@@ -413,9 +531,39 @@ template <typename TPairPotential, bool allow_anisotropic_pair_potential = true>
  */
 template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
   protected:
-    Space &spc;              //!< a space to operate on
-    TPairEnergy pair_energy; //!< a functor to compute non-bonded energy between two particles @see PairEnergy
-    GroupCutoff cut;         //!< a cutoff functor that determines if energy between two groups can be ignored
+    Space &spc;                   //!< a space to operate on
+    TPairEnergy pair_energy;      //!< a functor to compute non-bonded energy between two particles @see PairEnergy
+    GroupCutoff cut;              //!< a cutoff functor that determines if energy between two groups can be ignored
+    AtomicCellList cell_list;     //!< spatial index of atomic groups; used only if built, see updateCellList()
+    unsigned long long pair_cnt = 0; //!< statistics: number of inter-group particle pairs evaluated
+
+    /**
+     * @brief Pairing of a particle with the particles in an atomic group found in the cell list.
+     *
+     * Only valid if all pair potentials vanish beyond the pair cutoff.
+     *
+     * @param particle
+     * @param group  atomic group
+     * @param is_skipped  filter on indices relative to the group beginning, e.g., to avoid self-interaction
+     * @return energy sum between particle pairs
+     */
+    template <typename TGroup, typename TFilter>
+    double particle2neighbours(const Particle &particle, const TGroup &group, TFilter is_skipped) const {
+        double u = 0;
+        const int offset = std::distance(spc.p.cbegin(), ParticleVector::const_iterator(group.begin()));
+        const int group_size = group.size();
+        cell_list.forEachNeighbour(particle.pos, [&](int particle_index) {
+            const int i = particle_index - offset;
+            if (i >= 0 && i < group_size && !is_skipped(i)) {
+                u += particle2particle(particle, spc.p[particle_index]);
+            }
+        });
+        return u;
+    }
+
+    template <typename TGroup> double particle2neighbours(const Particle &particle, const TGroup &group) const {
+        return particle2neighbours(particle, group, [](int) { return false; });
+    }
 
   public:
     /**
@@ -428,17 +576,77 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
     void from_json(const json &j) {
         Energy::from_json(j, cut);
         pair_energy.from_json(j);
+        if (cut.getPairCutoff() > 0.0) {
+            if (spc.geo.type == Geometry::CUBOID || spc.geo.type == Geometry::SLIT) {
+                cell_list = AtomicCellList(cut.getPairCutoff());
+            } else {
+                faunus_logger->warn("cell list of atomic groups requires a cuboid or slit geometry");
+            }
+        }
     }
 
+    /**
+     * @brief Synchronise the cell list of atomic groups with particle positions.
+     *
+     * Must be called whenever particles in atomic groups may have moved, i.e., before energy evaluation of a change
+     * and after synchronisation with another state. Does nothing unless a pair cutoff is given.
+     */
+    void updateCellList(const Change &change) { cell_list.update(spc, change); }
+
     void to_json(json &j) const {
         pair_energy.to_json(j);
         Energy::to_json(j, cut);
+        if (pair_cnt > 0) {
+            j["pair evaluations"] = pair_cnt;
+        }
     }
 
+    const GroupCutoff &getGroupCutoff() const { return cut; }
+    bool isThreadSafe() const { return pair_energy.isThreadSafe(); } //!< Can pairs be evaluated concurrently?
+
     template <typename T> inline double particle2particle(const T &a, const T &b) const {
         return pair_energy.potential(a, b);
     }
 
+    /**
+     * @brief Energy between a particle and a contiguous range of particles within the group.
+     *
+     * Exclusions only exist between atoms at most `MoleculeData::maxExcludedDistance()` apart in the sequence.
+     * Hence only the pairs in this vicinity of the particle are looked up in the exclusion matrix while
+     * the remaining, typically much longer, parts of the range are summed without any branching.
+     *
+     * @param particle  particle to interact with the range; its position may differ from the one in the group
+     * @param group
+     * @param index  internal index of the particle within the group; must not lie within the range
+     * @param first  first internal index of the range
+     * @param last  end of the range (exclusive)
+     * @return energy sum between particle pairs
+     */
+    template <typename TParticle, typename TGroup>
+    double particle2range(const TParticle &particle, const TGroup &group, const int index, const int first,
+                          const int last) const {
+        double u = 0.0;
+        if (first >= last) {
+            return u;
+        }
+        const auto &moldata = group.traits();
+        const int vicinity = group.atomic ? 0 : moldata.maxExcludedDistance();
+        const int vicinity_first = std::clamp(index - vicinity, first, last);
+        const int vicinity_last = std::clamp(index + vicinity + 1, vicinity_first, last);
+        for (int i = first; i < vicinity_first; ++i) {
+            u += particle2particle(particle, group[i]);
+        }
+        for (int i = vicinity_first; i < vicinity_last; ++i) {
+            if (!moldata.isPairExcluded(index, i)) {
+                u += particle2particle(particle, group[i]);
+            }
+        }
+        for (int i = vicinity_last; i < last; ++i) {
+            u += particle2particle(particle, group[i]);
+        }
+        return u;
+    }
+
     /**
      * @brief Internal energy of a group.
      *
@@ -448,19 +656,13 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
      * @param group
      * @return energy sum between particle pairs
      */
-    template <typename TGroup> double groupInternal(const TGroup &group) {
+    template <typename TGroup> double groupInternal(const TGroup &group) const {
         double u = 0;
         auto &moldata = group.traits();
         if (!moldata.rigid) {
             const int group_size = group.size();
             for (int i = 0; i < group_size - 1; ++i) {
-                for (int j = i + 1; j < group_size; ++j) {
-                    // This compound condition is faster than an outer atomic condition;
-                    // tested on bulk example in GCC 9.2.
-                    if (group.atomic || !moldata.isPairExcluded(i, j)) {
-                        u += particle2particle(group[i], group[j]);
-                    }
-                }
+                u += particle2range(group[i], group, i, i + 1, group_size);
             }
         }
         return u;
@@ -479,26 +681,11 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
         double u = 0;
         auto &moldata = group.traits();
         if (!moldata.rigid) {
-            if (group.atomic) {
-                // speed optimization: non-bonded interaction exclusions do not need to be checked for atomic groups
-                for (int i = 0; i < index; ++i) {
-                    u += particle2particle(group[index], group[i]);
-                }
-                for (int i = index + 1; i < group.size(); ++i) {
-                    u += particle2particle(group[index], group[i]);
-                }
+            if (group.atomic && cell_list.isBuilt()) {
+                u = particle2neighbours(group[index], group, [index](int i) { return i == index; });
             } else {
-                // molecular group
-                for (int i = 0; i < index; ++i) {
-                    if (!moldata.isPairExcluded(index, i)) {
-                        u += particle2particle(group[index], group[i]);
-                    }
-                }
-                for (int i = index + 1; i < group.size(); ++i) {
-                    if (!moldata.isPairExcluded(index, i)) {
-                        u += particle2particle(group[index], group[i]);
-                    }
-                }
+                u = particle2range(group[index], group, index, 0, index) +
+                    particle2range(group[index], group, index, index + 1, static_cast<int>(group.size()));
             }
         }
         return u;
@@ -508,35 +695,49 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
      * @brief Partial internal energy of the group limited to the particles present in the index.
      *
      * Only such non-bonded pair interactions within the group are considered if at least one particle is present
-     * in the index. The pair exclusions defined in the molecule topology are honoured.
+     * in the index. The pair exclusions defined in the molecule topology are honoured. If the indexed particles
+     * have been moved rigidly with respect to each other, the pairs among them may be skipped (`moved2moved`)
+     * leaving only the moved × static pairs.
      *
      * @param group
-     * @param index  internal indices of particles within the group
+     * @param index  sorted internal indices of particles within the group
+     * @param moved2moved  include pairs where both particles are present in the index
      * @return energy sum between particle pairs
      */
-    template <typename TGroup, typename TIndex> double groupInternal(const TGroup &group, const TIndex &index) {
+    template <typename TGroup, typename TIndex>
+    double groupInternal(const TGroup &group, const TIndex &index, const bool moved2moved = true) {
         double u = 0;
         auto &moldata = group.traits();
         if (!moldata.rigid) {
             if (index.size() == 1) {
                 u = groupInternal(group, index[0]);
             } else {
-                // TODO investigate overhead of `index_complement` filtering;
                 // TODO perhaps allow different strategies based on the index-size/group-size ratio
-                auto index_complement = indexComplement(group.size(), index);
-                // moved <-> static
-                for (int i : index) {
-                    for (int j : index_complement) {
-                        if (!moldata.isPairExcluded(i, j)) {
-                            u += particle2particle(group[i], group[j]);
+                if (group.atomic && cell_list.isBuilt()) {
+                    // moved <-> static within the pair cutoff
+                    auto is_moved = [&index](int j) { return std::binary_search(index.begin(), index.end(), j); };
+                    for (int i : index) {
+                        u += particle2neighbours(group[i], group, is_moved);
+                    }
+                } else {
+                    // moved <-> static, i.e., the runs of static particles between the sorted moved ones
+                    const int group_size = group.size();
+                    for (int i : index) {
+                        int first = 0;
+                        for (int moved : index) {
+                            u += particle2range(group[i], group, i, first, moved);
+                            first = moved + 1;
                         }
+                        u += particle2range(group[i], group, i, first, group_size);
                     }
                 }
                 // moved <-> moved
-                for (auto i_it = index.begin(); i_it < index.end(); ++i_it) {
-                    for (auto j_it = std::next(i_it); j_it < index.end(); ++j_it) {
-                        if (!moldata.isPairExcluded(*i_it, *j_it)) {
-                            u += particle2particle(group[*i_it], group[*j_it]);
+                if (moved2moved) {
+                    for (auto i_it = index.begin(); i_it < index.end(); ++i_it) {
+                        for (auto j_it = std::next(i_it); j_it < index.end(); ++j_it) {
+                            if (!moldata.isPairExcluded(*i_it, *j_it)) {
+                                u += particle2particle(group[*i_it], group[*j_it]);
+                            }
                         }
                     }
                 }
@@ -561,6 +762,16 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
     template <typename TGroup> double group2group(const TGroup &group1, const TGroup &group2) {
         double u = 0;
         if (!cut(group1, group2)) {
+            if (cell_list.isBuilt() && (group1.atomic || group2.atomic)) {
+                // visit only particles in the atomic group near each particle in the other
+                const auto &atomic_group = group2.atomic ? group2 : group1;
+                const auto &other_group = group2.atomic ? group1 : group2;
+                for (auto &particle : other_group) {
+                    u += particle2neighbours(particle, atomic_group);
+                }
+                return u;
+            }
+            pair_cnt += group1.size() * group2.size();
             for (auto &particle1 : group1) {
                 for (auto &particle2 : group2) {
                     u += particle2particle(particle1, particle2);
@@ -590,6 +801,13 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
     double group2group(const TGroup &group1, const TGroup &group2, const std::vector<int> &index1) {
         double u = 0;
         if (!cut(group1, group2)) {
+            if (cell_list.isBuilt() && group2.atomic) {
+                for (auto particle1_ndx : index1) {
+                    u += particle2neighbours(group1[particle1_ndx], group2);
+                }
+                return u;
+            }
+            pair_cnt += index1.size() * group2.size();
             for (auto particle1_ndx : index1) {
                 for (auto &particle2 : group2) {
                     u += particle2particle(*(group1.begin() + particle1_ndx), particle2);
@@ -628,6 +846,7 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
                 u += group2group(group2, group1, index2);
                 // + (⊕group1 × ∁⊕group2)
                 auto index2_complement = indexComplement(group2.size(), index2);
+                pair_cnt += index1.size() * (group2.size() - index2.size());
                 for (auto particle1_ndx : index1) {
                     for (auto particle2_ndx : index2_complement) {
                         u += particle2particle(group2[particle2_ndx], group1[particle1_ndx]);
@@ -716,6 +935,76 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
         return u;
     }
 
+    /**
+     * @brief Complete cartesian pairing between particles in a ghost group and particles in all groups in space.
+     *
+     * ghost × space, where the ghost group is not stored in space
+     *
+     * If the distance between the groups is greater or equal to the group cutoff distance, the particle pairing
+     * between them is skipped. Unlike group2all(), the cutoff statistics are not updated and the method is
+     * hence safe to call concurrently, e.g., for test particle insertion on several threads.
+     *
+     * @param ghost  group with particles stored outside space
+     * @return energy sum between particle pairs
+     */
+    template <typename TGroup> double ghost2all(const TGroup &ghost) const {
+        double u = 0;
+        for (auto &other_group : spc.groups) {
+            if (!cut.isBeyondCutoff(ghost, other_group)) {
+                for (auto &particle1 : ghost) {
+                    for (auto &particle2 : other_group) {
+                        u += particle2particle(particle1, particle2);
+                    }
+                }
+            }
+        }
+        return u;
+    }
+
+    /**
+     * @brief Energies of a single particle in a group placed at a batch of trial positions.
+     *
+     * The particle is paired with all other groups, and with particles in its own group except those in the range
+     * `[ignore_first, ignore_last)`; pair exclusions are honoured. The particle itself is not moved. Other groups are
+     * skipped if their mass center is beyond the group cutoff distance from the trial position. Safe for concurrent
+     * use as no statistics are updated.
+     *
+     * @param group  group of the particle
+     * @param index  particle index relative to the group beginning
+     * @param positions  trial positions of the particle
+     * @param ignore_first  first particle in the group to ignore
+     * @param ignore_last  end of the range of particles in the group to ignore
+     * @param energies  output energy sum between particle pairs for each trial position
+     */
+    template <typename TGroup>
+    void particle2all(const TGroup &group, const int index, const PointVector &positions, const int ignore_first,
+                      const int ignore_last, std::vector<double> &energies) const {
+        energies.assign(positions.size(), 0.0);
+        const auto &moldata = group.traits();
+        const int group_size = group.size();
+        auto particle = group[index];
+        // particles in [first, last) except the ignored ones
+        auto particle2kept = [&](const int first, const int last) {
+            return particle2range(particle, group, index, first, std::min(last, ignore_first)) +
+                   particle2range(particle, group, index, std::max(first, ignore_last), last);
+        };
+        for (size_t k = 0; k < positions.size(); ++k) {
+            particle.pos = positions[k];
+            double u = 0.0;
+            if (!moldata.rigid) {
+                u += particle2kept(0, index) + particle2kept(index + 1, group_size);
+            }
+            for (auto &other_group : spc.groups) {
+                if (&other_group != &group && !cut.isBeyondCutoff(particle.pos, group.id, other_group)) {
+                    for (auto &other_particle : other_group) {
+                        u += particle2particle(particle, other_particle);
+                    }
+                }
+            }
+            energies[k] = u;
+        }
+    }
+
     /**
      * @brief Complete cartesian pairing between a single particle in a group and particles in other groups in space.
      *
@@ -733,7 +1022,10 @@ template <typename TPairEnergy, typename TCutoff> class PairingBasePolicy {
         const auto &particle = group[index];
         for (auto &other_group : spc.groups) {
             if (&other_group != &group) {                      // avoid self-interaction
-                if (!cut(other_group, group)) {                // check g2g cut-off
+                if (cell_list.isBuilt() && other_group.atomic) {
+                    u += particle2neighbours(particle, other_group);
+                } else if (!cut(other_group, group)) {         // check g2g cut-off
+                    pair_cnt += other_group.size();
                     for (auto &other_particle : other_group) { // loop over particles in other group
                         u += particle2particle(particle, other_particle);
                     }
@@ -871,12 +1163,32 @@ class PairingPolicy : public PairingBasePolicy<TPairEnergy, TCutoff> {
     using PairingBasePolicy<TPairEnergy, TCutoff>::PairingBasePolicy;
 };
 
+/**
+ * @brief Common, non-templated interface for all non-bonded energies
+ */
+class NonbondedBase : public Energybase {
+  public:
+    virtual const GroupCutoff &getGroupCutoff() const = 0; //!< Group-to-group cutoffs used by the pairing policy
+    virtual bool isCached() const { return false; }        //!< True if energies are accumulated between moves
+
+    /**
+     * @brief Energies of a single particle placed at a batch of trial positions
+     *
+     * Used for incremental (re)growth of molecules where the particles in the group range
+     * `[ignore_first, ignore_last)` are not yet placed.
+     *
+     * @see PairingBasePolicy::particle2all()
+     */
+    virtual void particleEnergies(const Space::Tgroup &group, int index, const PointVector &positions,
+                                  int ignore_first, int ignore_last, std::vector<double> &energies) const = 0;
+};
+
 /**
  * @brief Computes change in the non-bonded energy, assuming pair-wise additive energy terms.
  *
  * @tparam TPairingPolicy  pairing policy to effectively sum up the pair-wise additive non-bonded energy
  */
-template <typename TPairingPolicy> class Nonbonded : public Energybase {
+template <typename TPairingPolicy> class Nonbonded : public NonbondedBase {
   protected:
     Space &spc;             //!< space to operate on
     TPairingPolicy pairing; //!< pairing policy to effectively sum up the pair-wise additive non-bonded energy
@@ -901,7 +1213,8 @@ template <typename TPairingPolicy> class Nonbonded : public Energybase {
             const bool change_all = change_data.atoms.empty(); // all particles or only their subset?
             u = change_all ? pairing.group2all(group) : pairing.group2all(group, change_data.atoms);
             if (change_data.internal) {
-                u += change_all ? pairing.groupInternal(group) : pairing.groupInternal(group, change_data.atoms);
+                u += change_all ? pairing.groupInternal(group)
+                                : pairing.groupInternal(group, change_data.atoms, change_data.moved2moved);
             }
         }
         return u;
@@ -958,6 +1271,27 @@ template <typename TPairingPolicy> class Nonbonded : public Energybase {
 
     void to_json(json &j) const override { pairing.to_json(j); }
 
+    const GroupCutoff &getGroupCutoff() const override { return pairing.getGroupCutoff(); }
+
+    /**
+     * @brief Rebuilds the cell list of atomic groups, if any.
+     */
+    void init() override {
+        Change change;
+        change.all = true;
+        pairing.updateCellList(change);
+    }
+
+    /**
+     * @brief Updates the cell list of atomic groups, if any, to the particle positions copied from the other state.
+     */
+    void sync(Energybase *, Change &change) override { pairing.updateCellList(change); }
+
+    void particleEnergies(const Space::Tgroup &group, int index, const PointVector &positions, int ignore_first,
+                          int ignore_last, std::vector<double> &energies) const override {
+        pairing.particle2all(group, index, positions, ignore_first, ignore_last, energies);
+    }
+
     /**
      * @brief Calculates the force on all particles.
      *
@@ -965,6 +1299,26 @@ template <typename TPairingPolicy> class Nonbonded : public Energybase {
      */
     void force(std::vector<Point> &forces) override { pairing.force(forces); }
 
+    /**
+     * @brief Computes non-bonded energy of a ghost group with all particles in space.
+     *
+     * As for an inserted group, the internal energy is added only for atomic groups.
+     *
+     * @param ghost  group with particles stored outside space
+     * @return energy sum between particle pairs
+     * @throw std::logic_error if the pair potential is not thread-safe, e.g., a `custom` potential
+     */
+    double ghostEnergy(const Space::Tgroup &ghost) const override {
+        if (!pairing.isThreadSafe()) {
+            throw std::logic_error(name + ": pair potential cannot be evaluated concurrently");
+        }
+        double u = pairing.ghost2all(ghost);
+        if (ghost.atomic) {
+            u += pairing.groupInternal(ghost);
+        }
+        return u;
+    }
+
     /**
      * @brief Computes non-bonded energy contribution from changed particles.
      *
@@ -976,6 +1330,7 @@ template <typename TPairingPolicy> class Nonbonded : public Energybase {
      */
     double energy(Change &change) override {
         assert(std::is_sorted(change.groups.begin(), change.groups.end()));
+        pairing.updateCellList(change);
         double u = 0;
         if (change.all) {
             u = pairing.all();
@@ -1000,117 +1355,192 @@ template <typename TPairingPolicy> class Nonbonded : public Energybase {
 
 
 /**
- * @brief Computes non-bonded energy contribution from changed particles. Cache group2group energy once calculated,
- * until a new trial configuration is provided. Not for general use as only partially implemented!
+ * @brief Computes non-bonded energy contribution from changed particles using a sparse cache of group-to-group
+ * energies.
+ *
+ * Only non-zero group pair energies are stored, hence pairs separated beyond the group cutoff distance
+ * (`cutoff_g2g`) take no memory. Each group owns a row mapping indices of neighbouring groups to the pair energy;
+ * rows are kept symmetric, and a running sum of all cached pair energies is maintained. The trial state recomputes
+ * the rows of changed groups, while the accepted state merely sums the cached rows. A single group move therefore
+ * touches a single row only. Internal energies are not cached but computed as in Nonbonded.
  *
- * Original implementation, only refurbished. Generally suboptimal as only PairingPolicy::group2group method
- * may be called.
- * No internal energy is ever computed. Cannot deal with particle count changes. And other unmentioned constrains.
+ * Rows are always evaluated for whole groups, so the cache is inefficient for moves of a few particles in large
+ * atomic groups.
  *
  * @tparam Tpairpot
  */
 template <typename Tpairpot> class NonbondedCached : public Nonbonded<PairingPolicy<PairEnergy<Tpairpot>, GroupCutoff>> {
     typedef Nonbonded<PairingPolicy<PairEnergy<Tpairpot>, GroupCutoff>> base;
     typedef typename Space::Tgroup Tgroup;
-    Eigen::MatrixXf cache;
+    typedef std::unordered_map<int, double> Trow; //!< neighbouring group index → pair energy
+    std::vector<Trow> cache;                      //!< sparse and symmetric group-to-group energies; zeros not stored
+    std::vector<bool> is_changed;                 //!< changed groups; reused between calls and kept all false
+    using base::pairing;
     using base::spc;
 
-    double g2g(const Tgroup &g1, const Tgroup &g2) {
-        int i = &g1 - spc.groups.data();
-        int j = &g2 - spc.groups.data();
-        if (j < i) {
-            std::swap(i, j);
+    bool isTrialState() const { return base::key != Energybase::ACCEPTED_MONTE_CARLO_STATE; }
+
+    /**
+     * @brief Stores energy of the pair (i, j).
+     */
+    void setPairEnergy(int i, int j, double u) {
+        if (u == 0.0) {
+            if (cache[i].erase(j) > 0) {
+                cache[j].erase(i);
+            }
+            return;
         }
-        if (base::key == Energybase::TRIAL_MONTE_CARLO_STATE) { // if this is from the trial system,
-            cache(i, j) = base::pairing.group2group(g1, g2); // update the cache
+        cache[i][j] = cache[j][i] = u;
+    }
+
+    /**
+     * @brief Sum of all cached pair energies.
+     *
+     * Summed from the cache on each call rather than kept as a running sum which would accumulate round-off
+     * errors over the course of a simulation.
+     */
+    double pairEnergySum() const {
+        double u = 0.0;
+        for (size_t i = 0; i < cache.size(); ++i) {
+            for (const auto &[j, u_ij] : cache[i]) {
+                if (j > static_cast<int>(i)) {
+                    u += u_ij;
+                }
+            }
         }
-        return cache(i, j); // return (cached) value
+        return u;
     }
 
-    double g2g(const Tgroup &g1, const Tgroup &g2, [[maybe_unused]] const std::vector<int> &index) {
-        // index not implemented
-        return g2g(g1, g2);
+    /**
+     * @brief Recalculates cache for all pairs; only in the trial state or on initialization.
+     */
+    void updateAll() {
+        const auto num_groups = static_cast<int>(spc.groups.size());
+        cache.assign(num_groups, Trow());
+        is_changed.assign(num_groups, false);
+        for (int i = 0; i < num_groups; ++i) {
+            for (int j = i + 1; j < num_groups; ++j) {
+                setPairEnergy(i, j, pairing.group2group(spc.groups[i], spc.groups[j]));
+            }
+        }
+    }
+
+    /**
+     * @brief Energy between changed groups and all other groups.
+     *
+     * In the trial state, the rows of the changed groups are recalculated before summation. If `changed2changed` is
+     * false, pairs in between changed groups are neither recalculated nor included in the sum.
+     *
+     * @param changed  indices of changed groups
+     * @param changed2changed  include interactions between changed groups?
+     * @return energy sum between group pairs
+     */
+    double changedGroupsEnergy(const std::vector<int> &changed, bool changed2changed) {
+        const auto num_groups = static_cast<int>(spc.groups.size());
+        for (auto i : changed) {
+            is_changed[i] = true;
+        }
+        auto is_included = [&](int i, int j) { return !is_changed[j] || (changed2changed && j > i); };
+        double u = 0.0;
+        for (auto i : changed) {
+            if (isTrialState()) {
+                for (int j = 0; j < num_groups; ++j) {
+                    if (j != i && is_included(i, j)) {
+                        setPairEnergy(i, j, pairing.group2group(spc.groups[i], spc.groups[j]));
+                    }
+                }
+            }
+            for (const auto &[j, u_ij] : cache[i]) {
+                if (is_included(i, j)) {
+                    u += u_ij;
+                }
+            }
+        }
+        for (auto i : changed) {
+            is_changed[i] = false;
+        }
+        return u;
+    }
+
+    /**
+     * @brief Internal energy of a changed group as in Nonbonded::energyGroup.
+     */
+    double internalEnergy(const Change::data &change_data) {
+        if (!change_data.internal) {
+            return 0.0;
+        }
+        const auto &group = spc.groups.at(change_data.index);
+        if (change_data.atoms.empty()) {
+            return pairing.groupInternal(group);
+        } else if (change_data.atoms.size() == 1) {
+            return pairing.groupInternal(group, change_data.atoms[0]);
+        }
+        return pairing.groupInternal(group, change_data.atoms, change_data.moved2moved);
+    }
+
+    /**
+     * @brief Internal energy of a changed group as in Nonbonded::energySpeciation, i.e. for added particles only.
+     */
+    double internalEnergySpeciation(const Change::data &change_data) {
+        const auto &group = spc.groups.at(change_data.index);
+        const auto size = static_cast<int>(group.size());
+        const std::vector<int> index = change_data.atoms |
+                                       ranges::views::filter([size](const auto i) { return i < size; }) |
+                                       ranges::to<std::vector>;
+        if (index.empty() || molecules.at(group.id).rigid) {
+            return 0.0;
+        }
+        return change_data.all ? pairing.groupInternal(group) : pairing.groupInternal(group, index);
     }
 
   public:
+    /**
+     * Without a finite group-to-group cutoff, all pairs of interacting groups are cached, which for many groups
+     * requires considerably more memory than a dense matrix and hence a warning is issued.
+     */
     NonbondedCached(const json &j, Space &spc, BasePointerVector<Energybase> &pot) : base(j, spc, pot) {
         base::name += "EM";
+        const auto &cutoff = pairing.getGroupCutoff();
+        const bool has_cutoff = std::any_of(molecules.begin(), molecules.end(), [&](const auto &molecule1) {
+            return std::any_of(molecules.begin(), molecules.end(), [&](const auto &molecule2) {
+                return std::isfinite(cutoff.getCutoff(molecule1.id(), molecule2.id()));
+            });
+        });
+        if (!has_cutoff) {
+            faunus_logger->warn("{}: without a finite cutoff_g2g all group pairs are cached", base::name);
+        }
         init();
     }
 
-  /**
-   * @brief Cache pair interactions in matrix.
-   */
-    void init() override {
-        const auto groups_size = spc.groups.size();
-        cache.resize(groups_size, groups_size);
-        cache.setZero();
-        for (auto i = 0; i < groups_size - 1; ++i) {
-            for (auto j = i + 1; j < groups_size; ++j) {
-                cache(i, j) = base::pairing.group2group(spc.groups[i], spc.groups[j]);
-            }
-        }
-    }
+    void init() override { updateAll(); }
+    bool isCached() const override { return true; }
 
     double energy(Change &change) override {
-        // Only g2g may be called there to compute (and cache) energy!
-        double u = 0;
-        if (change) {
-            if (change.all || change.dV) {
-                for (auto i = spc.groups.begin(); i < spc.groups.end(); ++i) {
-                    for (auto j = std::next(i); j < base::spc.groups.end(); ++j) {
-                        u += g2g(*i, *j);
-                    }
-                }
-            } else {
-                if (change.groups.size() == 1) { // if exactly ONE molecule is changed
-                    auto &d = change.groups[0];
-                    auto &g1 = spc.groups.at(d.index);
-                    for (auto g2_it = spc.groups.begin(); g2_it < spc.groups.end(); ++g2_it) {
-                        if (&g1 != &(*g2_it)) {
-                            u += g2g(g1, *g2_it, d.atoms);
-                        }
-                    }
-                } else {                                     // many molecules are changed
-                    auto moved = change.touchedGroupIndex(); // index of moved groups
-                    // moved<->moved
-                    if (change.moved2moved) {
-                        for (auto i = moved.begin(); i < moved.end(); ++i) {
-                            for (auto j = std::next(i); j < moved.end(); ++j) {
-                                u += g2g(spc.groups[*i], spc.groups[*j]);
-                            }
-                        }
-                    }
-                    // moved<->static
-#if true
-                    // classic version
-                    auto fixed = indexComplement(spc.groups.size(), moved); // index of static groups
-                    for (auto i : moved) {
-                        for (auto j : fixed) {
-                            u += g2g(spc.groups[i], spc.groups[j]);
-                        }
-                    }
-#else
-                    // OMP-ready version
-                    auto fixed =
-                        indexComplement(spc.groups.size(), moved) | ranges::to<std::vector>; // index of static groups
-                    const size_t moved_size = moved.size();
-                    const size_t fixed_size = fixed.size();
-                    for (auto i = 0; i < moved_size; ++i) {
-                        for (auto j = 0; j < fixed_size; ++j) {
-                            u += g2g(spc.groups[moved[i]], spc.groups[fixed[j]]);
-                        }
-                    }
-#endif
+        assert(std::is_sorted(change.groups.begin(), change.groups.end()));
+        assert(cache.size() == spc.groups.size());
+        double u = 0.0;
+        if (change.all || change.dV) {
+            if (isTrialState()) {
+                updateAll();
+            }
+            u = pairEnergySum();
+            for (const auto &group : spc.groups) {
+                if (change.all || group.atomic || group.compressible) {
+                    u += pairing.groupInternal(group);
                 }
             }
-            // more todo!
+        } else if (change) {
+            const std::vector<int> changed = change.touchedGroupIndex() | ranges::to<std::vector>;
+            u = changedGroupsEnergy(changed, change.dN || change.moved2moved);
+            for (const auto &change_data : change.groups) {
+                u += change.dN ? internalEnergySpeciation(change_data) : internalEnergy(change_data);
+            }
         }
         return u;
     }
 
     /**
-     * @brief Copy energy matrix from other
+     * @brief Copy cached rows of changed groups from other
      * @param base_ptr
      * @param change
      */
@@ -1118,15 +1548,18 @@ template <typename Tpairpot> class NonbondedCached : public Nonbonded<PairingPol
         auto other = dynamic_cast<decltype(this)>(base_ptr);
         assert(other);
         if (change.all || change.dV) {
-            cache.triangularView<Eigen::StrictlyUpper>() =
-                (other->cache).template triangularView<Eigen::StrictlyUpper>();
+            cache = other->cache;
+            is_changed.assign(cache.size(), false);
         } else {
-            for (auto &d : change.groups) {
-                for (int i = 0; i < d.index; i++) {
-                    cache(i, d.index) = other->cache(i, d.index);
+            for (const auto &change_data : change.groups) {
+                for (const auto &neighbour : cache[change_data.index]) {
+                    cache[neighbour.first].erase(change_data.index);
                 }
-                for (size_t i = d.index + 1; i < spc.groups.size(); i++) {
-                    cache(d.index, i) = other->cache(d.index, i);
+                cache[change_data.index] = other->cache[change_data.index];
+            }
+            for (const auto &change_data : change.groups) { // restore symmetry
+                for (const auto &[j, u_ij] : cache[change_data.index]) {
+                    cache[j][change_data.index] = u_ij;
                 }
             }
         }
@@ -1180,10 +1613,22 @@ class Hamiltonian : public Energybase, public BasePointerVector<Energybase> {
     double maxenergy = pc::infty; //!< Maximum allowed energy change
     void to_json(json &) const override;
     void addEwald(const json &, Space &); //!< Adds an instance of reciprocal space Ewald energies (if appropriate)
+    template <typename TPairPotential, bool allow_anisotropic_pair_potential>
+    void addNonbonded(const json &, Space &); //!< Adds Nonbonded specialised for the boundary conditions of `Space::geo`
     void force(PointVector &) override;
+
+    unsigned int adaptive_order_interval = 0;       //!< Re-order terms every n'th energy call; zero = input order
+    unsigned long long num_energy_calls = 0;         //!< Number of calls to `energy()`
+    std::vector<size_t> evaluation_order;            //!< Term indices in order of evaluation (adaptive mode)
+    std::vector<double> term_energies;               //!< Energy of each term in the latest evaluation
+    std::vector<unsigned long long> trigger_counts;  //!< Number of times each term reached `maxenergy`
+    double energyAdaptiveOrder(Change &);            //!< Energy with terms evaluated in adaptive order
+    void updateEvaluationOrder();                    //!< Order terms by cost per triggered rejection
+
   public:
     Hamiltonian(Space &spc, const json &j);
     double energy(Change &change) override; //!< Energy due to changes
+    double ghostEnergy(const Space::Tgroup &) const override; //!< Energy of group not in Space
     void init() override;
     void sync(Energybase *basePtr, Change &change) override;
 }; //!< Aggregates and sum energy terms
@@ -99,6 +99,79 @@ TEST_CASE("[Faunus] Ewald - IonIonPolicy") {
     }*/
 }
 
+TEST_CASE("[Faunus] Ewald - scaled volume move") {
+    // for atomic groups, positions scale with the box and k·r is invariant so only the box is updated
+    Space spc;
+    spc.geo = R"( {"type": "cuboid", "length": 20} )"_json;
+    spc.p.resize(20);
+    for (size_t i = 0; i < spc.p.size(); i++) {
+        spc.p[i].charge = (i % 2 == 0) ? 1.0 : -1.0;
+        spc.geo.randompos(spc.p[i].pos, Faunus::random);
+    }
+    spc.p[0].charge = 2.0; // net charge to include the background term
+    Group<Particle> g(spc.p.begin(), spc.p.end());
+    g.atomic = true;
+    spc.groups.push_back(g);
+
+    const json input = R"({"epsr": 1.0, "alpha": 0.3, "epss": 1.0, "ncutoff": 6.0, "cutoff": 9.0})"_json;
+    Ewald scaled(input, spc);
+    scaled.key = Energybase::TRIAL_MONTE_CARLO_STATE;
+    Change change;
+    change.dV = true;
+    change.all = true;
+    const double energy_before = scaled.energy(change);
+
+    spc.scaleVolume(1.3 * spc.geo.getVolume());
+    const double energy_after = scaled.energy(change); // scaled path
+    Ewald full(input, spc);                             // not notified by the volume trigger
+    full.key = Energybase::TRIAL_MONTE_CARLO_STATE;
+    CHECK(energy_after == Approx(full.energy(change))); // full updateComplex()
+    CHECK(energy_after != Approx(energy_before));
+}
+
+TEST_CASE("[Faunus] Ewald - reciprocal forces") {
+    // more particles than one block of phase factors, compared with the numeric energy gradient
+    Space spc;
+    spc.geo = R"( {"type": "cuboid", "length": 30} )"_json;
+    spc.p.resize(600);
+    for (size_t i = 0; i < spc.p.size(); i++) {
+        spc.p[i].charge = (i % 2 == 0) ? 1.0 : -1.0;
+        spc.geo.randompos(spc.p[i].pos, Faunus::random);
+    }
+    Group<Particle> g(spc.p.begin(), spc.p.end());
+    g.atomic = true;
+    spc.groups.push_back(g);
+
+    Ewald ewald(R"({"epsr": 80.0, "alpha": 0.2, "epss": 1.0, "ncutoff": 3.0, "cutoff": 12.0})"_json, spc);
+    ewald.key = Energybase::TRIAL_MONTE_CARLO_STATE; // all k-vectors are updated on every call
+    Change change;
+    change.all = true;
+    ewald.energy(change);
+    std::vector<Point> forces(spc.p.size(), Point::Zero());
+    ewald.force(forces);
+
+    const double delta = 1e-4;
+    for (size_t i : {0, 1, 511, 512, 599}) {
+        Point numeric_force;
+        for (int dim = 0; dim < 3; dim++) {
+            spc.p[i].pos[dim] += delta;
+            const double energy_forward = ewald.energy(change);
+            spc.p[i].pos[dim] -= 2.0 * delta;
+            const double energy_backward = ewald.energy(change);
+            spc.p[i].pos[dim] += delta;
+            numeric_force[dim] = -(energy_forward - energy_backward) / (2.0 * delta);
+        }
+        for (int dim = 0; dim < 3; dim++) {
+            CHECK(forces[i][dim] == Approx(numeric_force[dim]).epsilon(1e-4).scale(1e-2));
+        }
+    }
+
+    ewald.energy(change);
+    auto accumulated_forces = forces;
+    ewald.force(accumulated_forces); // forces are added to the destination vector
+    CHECK(accumulated_forces[599].isApprox(2.0 * forces[599]));
+}
+
 TEST_CASE("[Faunus] Ewald - IonIonPolicy Benchmarks") {
   Space spc;
   spc.geo = R"( {"type": "cuboid", "length": 80} )"_json;
@@ -132,6 +205,252 @@ TEST_CASE("[Faunus] Ewald - IonIonPolicy Benchmarks") {
   }
 }
 
+TEST_CASE("[Faunus] PairingPolicy - groupInternal") {
+    const json input = R"({
+        "geometry": {"type": "cuboid", "length": 50},
+        "atomlist": [ {"ALA": {"sigma": 3.0, "eps": 0.5}} ],
+        "moleculelist": [ {"chain": {"excluded_neighbours": 2, "exclusionlist": [[3, 9]],
+            "structure": {"fasta": "AAAAAAAAAAAA", "k": 3, "req": 4}}} ],
+        "insertmolecules": [ {"chain": {"N": 1}} ]
+    })"_json;
+    Faunus::atoms = input.at("atomlist").get<decltype(atoms)>();
+    Faunus::molecules = input.at("moleculelist").get<decltype(molecules)>();
+    Space spc;
+    from_json(input, spc);
+    BasePointerVector<Energybase> potentials;
+    PairingPolicy<PairEnergy<Potential::LennardJones, false>, GroupCutoff> pairing(spc, potentials);
+    pairing.from_json(R"({"mixing": "LB"})"_json);
+
+    const auto &group = spc.groups.at(0);
+    const auto &moldata = group.traits();
+    const int group_size = group.size();
+    REQUIRE(moldata.maxExcludedDistance() == 6);
+
+    // all non-excluded pairs with at least one (or exactly one) particle in the index
+    auto brute_force = [&](const std::vector<int> &index, bool moved2moved) {
+        auto is_moved = [&](int i) { return std::find(index.begin(), index.end(), i) != index.end(); };
+        double u = 0.0;
+        for (int i = 0; i < group_size; ++i) {
+            for (int j = i + 1; j < group_size; ++j) {
+                const int moved_cnt = is_moved(i) + is_moved(j);
+                if (moved_cnt > 0 && (moved2moved || moved_cnt == 1) && !moldata.isPairExcluded(i, j)) {
+                    u += pairing.particle2particle(group[i], group[j]);
+                }
+            }
+        }
+        return u;
+    };
+
+    std::vector<int> all(group_size);
+    std::iota(all.begin(), all.end(), 0);
+    CHECK(pairing.groupInternal(group) == Approx(brute_force(all, true)));
+    for (int i : {0, 3, 9, 11}) {
+        CHECK(pairing.groupInternal(group, i) == Approx(brute_force({i}, true)));
+    }
+    const std::vector<std::vector<int>> indices = {{2, 3, 4}, {0, 5, 11}, {3, 9}, {1, 6, 7, 8}};
+    for (const auto &index : indices) {
+        CHECK(pairing.groupInternal(group, index, true) == Approx(brute_force(index, true)));
+        CHECK(pairing.groupInternal(group, index, false) == Approx(brute_force(index, false)));
+    }
+}
+
+TEST_CASE("[Faunus] NonbondedCached") {
+    const json input = R"({
+        "geometry": {"type": "cuboid", "length": 30},
+        "atomlist": [ {"A": {"sigma": 3.0, "eps": 0.5}}, {"B": {"sigma": 4.0, "eps": 0.2}} ],
+        "moleculelist": [ {"dimer": {"rigid": true,
+            "structure": [ {"A": [0.0, 0.0, 0.0]}, {"B": [3.5, 0.0, 0.0]} ]}} ],
+        "insertmolecules": [ {"dimer": {"N": 8}}, {"dimer": {"N": 2, "inactive": true}} ]
+    })"_json;
+    Faunus::atoms = input.at("atomlist").get<decltype(atoms)>();
+    Faunus::molecules = input.at("moleculelist").get<decltype(molecules)>();
+    Space spc;
+    from_json(input, spc);
+    REQUIRE(spc.groups.size() == 10);
+
+    const json pair_potential = R"({"mixing": "LB"})"_json;
+    BasePointerVector<Energybase> potentials;
+    Nonbonded<PairingPolicy<PairEnergy<Potential::LennardJones, false>, GroupCutoff>> nonbonded(pair_potential, spc,
+                                                                                                potentials);
+    NonbondedCached<Potential::LennardJones> trial(pair_potential, spc, potentials);
+    NonbondedCached<Potential::LennardJones> accepted(pair_potential, spc, potentials);
+    trial.key = Energybase::TRIAL_MONTE_CARLO_STATE; // rows of changed groups are recalculated
+    accepted.key = Energybase::ACCEPTED_MONTE_CARLO_STATE;
+
+    auto groupChange = [](const std::vector<int> &indices, bool dN = false) {
+        Change change;
+        change.dN = dN;
+        for (int index : indices) {
+            Change::data change_data;
+            change_data.index = index;
+            change_data.all = true;
+            change_data.internal = dN;
+            if (dN) {
+                change_data.atoms = {0, 1};
+            }
+            change.groups.push_back(change_data);
+        }
+        return change;
+    };
+
+    // the trial state recalculates, the accepted state sums the synchronised cache
+    auto compare = [&](Change &change) {
+        const double energy = nonbonded.energy(change);
+        CHECK(trial.energy(change) == Approx(energy));
+        accepted.sync(&trial, change);
+        CHECK(accepted.energy(change) == Approx(energy));
+    };
+
+    Change change_all;
+    change_all.all = true;
+    CHECK(trial.energy(change_all) == Approx(nonbonded.energy(change_all)));
+    CHECK(accepted.energy(change_all) == Approx(nonbonded.energy(change_all)));
+
+    SUBCASE("Single group") {
+        spc.groups[2].translate({1.0, 0.5, 0.0}, spc.geo.getBoundaryFunc());
+        auto change = groupChange({2});
+        compare(change);
+    }
+    SUBCASE("Multiple groups") {
+        spc.groups[1].translate({1.0, 0.5, 0.0}, spc.geo.getBoundaryFunc());
+        spc.groups[5].translate({1.0, 0.5, 0.0}, spc.geo.getBoundaryFunc());
+        auto change = groupChange({1, 5});
+        compare(change);
+        change.moved2moved = false;
+        compare(change);
+    }
+    SUBCASE("Insertion and deletion") {
+        auto &inserted = spc.groups[8];
+        inserted.activate(inserted.end(), inserted.trueend());
+        auto insertion = groupChange({8}, true);
+        compare(insertion);
+
+        auto &deleted = spc.groups[3];
+        auto deletion = groupChange({3}, true);
+        compare(deletion); // before deletion
+        deleted.deactivate(deleted.begin(), deleted.end());
+        compare(deletion);
+    }
+    CHECK(accepted.energy(change_all) == Approx(nonbonded.energy(change_all)));
+}
+
+TEST_CASE("[Faunus] Hamiltonian - adaptive_order") {
+    json input = R"({
+        "geometry": {"type": "cuboid", "length": 40},
+        "atomlist": [ {"A": {"sigma": 3.0, "eps": 0.5}}, {"B": {"sigma": 4.0, "eps": 0.2}} ],
+        "moleculelist": [ {"dimer": {"rigid": true,
+            "structure": [ {"A": [0.0, 0.0, 0.0]}, {"B": [3.5, 0.0, 0.0]} ]}} ],
+        "insertmolecules": [ {"dimer": {"N": 20}} ],
+        "energy": [ {"nonbonded": {"default": [ {"lennardjones": {"mixing": "LB"}} ]}},
+                    {"confine": {"type": "sphere", "radius": 10, "k": "inf", "com": true, "molecules": ["dimer"]}},
+                    {"maxenergy": 100} ]
+    })"_json;
+    Faunus::atoms = input.at("atomlist").get<decltype(atoms)>();
+    Faunus::molecules = input.at("moleculelist").get<decltype(molecules)>();
+    Faunus::random = Random();
+    Space spc;
+    from_json(input, spc);
+    Hamiltonian reference(spc, input.at("energy"));
+    input["energy"].push_back({{"adaptive_order", 10}});
+    Hamiltonian adaptive(spc, input.at("energy"));
+    for (auto hamiltonian : {&reference, &adaptive}) {
+        hamiltonian->key = Energybase::ACCEPTED_MONTE_CARLO_STATE;
+        hamiltonian->init();
+    }
+
+    // move random dimers to random positions, mostly outside the confining sphere
+    for (int step = 0; step < 500; step++) {
+        const auto index = Faunus::random.range(0, static_cast<int>(spc.groups.size()) - 1);
+        auto &group = spc.groups[index];
+        Point position;
+        spc.geo.randompos(position, Faunus::random);
+        group.translate(spc.geo.vdist(position, group.cm), spc.geo.getBoundaryFunc());
+        Change change;
+        Change::data change_data;
+        change_data.index = index;
+        change_data.all = true;
+        change.groups.push_back(change_data);
+        const double energy = reference.energy(change);
+        if (energy < 100) {
+            CHECK(adaptive.energy(change) == Approx(energy));
+        } else {
+            CHECK(adaptive.energy(change) >= 100);
+        }
+    }
+    // the cheap confinement term is evaluated first and the pair energy is mostly skipped
+    const auto &nonbonded = adaptive.vec.at(0);
+    const auto &confine = adaptive.vec.at(1);
+    CHECK(nonbonded->timer.calls() < confine->timer.calls() / 2);
+    CHECK(reference.vec.at(0)->timer.calls() == 500); // input order always starts with the pair energy
+}
+
+TEST_CASE("[Faunus] GroupCutoff - cutoff_pair") {
+    Space::Tgeometry geometry = R"( {"type": "cuboid", "length": 50} )"_json;
+    GroupCutoff cutoff(geometry);
+    json input = R"( {"default": [ {"coulomb": {"type": "ewald", "epsr": 80, "alpha": 0.2, "cutoff": 12}},
+                                   {"cos2": {"eps": 1.0, "rc": 8.0, "wc": 3.0}} ]} )"_json;
+    SUBCASE("Longer than pair potential cutoffs") {
+        input["cutoff_pair"] = 12.0;
+        from_json(input, cutoff);
+        CHECK(cutoff.getPairCutoff() == doctest::Approx(12.0));
+    }
+    SUBCASE("Shorter than Ewald real-space cutoff") {
+        input["cutoff_pair"] = 11.5;
+        CHECK_THROWS_AS(from_json(input, cutoff), ConfigurationError);
+    }
+    SUBCASE("Shorter than cos2 range") {
+        input["default"][0]["coulomb"]["cutoff"] = 10;
+        input["cutoff_pair"] = 10.0;
+        CHECK_THROWS_AS(from_json(input, cutoff), ConfigurationError);
+    }
+}
+
+TEST_CASE("[Faunus] AtomicCellList") {
+    Space spc;
+    spc.geo = R"( {"type": "cuboid", "length": [30, 24, 12]} )"_json;
+    spc.p.resize(500);
+    Random random;
+    for (auto &particle : spc.p) {
+        spc.geo.randompos(particle.pos, random);
+    }
+    Group<Particle> group(spc.p.begin(), spc.p.end());
+    group.atomic = true;
+    spc.groups.push_back(group);
+
+    const double cutoff = 5.0;
+    AtomicCellList cell_list(cutoff);
+    CHECK_FALSE(cell_list.isBuilt());
+    cell_list.build(spc);
+    CHECK(cell_list.isBuilt());
+
+    // all particles within the cutoff must be visited exactly once
+    auto check_neighbours = [&](const Point &position) {
+        std::vector<int> visited;
+        cell_list.forEachNeighbour(position, [&](int i) { visited.push_back(i); });
+        std::sort(visited.begin(), visited.end());
+        CHECK(std::adjacent_find(visited.begin(), visited.end()) == visited.end());
+        for (size_t i = 0; i < spc.p.size(); ++i) {
+            if (spc.geo.sqdist(position, spc.p[i].pos) < cutoff * cutoff) {
+                CHECK(std::binary_search(visited.begin(), visited.end(), static_cast<int>(i)));
+            }
+        }
+    };
+    check_neighbours({0.0, 0.0, 0.0});
+    check_neighbours({14.9, -11.9, 5.9});
+
+    SUBCASE("Update") {
+        Change change;
+        change.groups.resize(1);
+        change.groups[0].index = 0;
+        change.groups[0].atoms = {3, 7};
+        spc.p[3].pos = {14.9, -11.9, 5.9};
+        spc.p[7].pos = {-14.9, 11.9, -5.9};
+        cell_list.update(spc, change);
+        check_neighbours({14.0, 11.0, 5.0});
+        check_neighbours({-14.0, -11.0, -5.0});
+    }
+}
+
 #ifdef ENABLE_FREESASA
 TEST_CASE("[Faunus] FreeSASA") {
     Change change; // change object telling that a full energy calculation
@@ -16,10 +16,26 @@ void Energybase::sync(Energybase *, Change &) {}
 
 void Energybase::init() {}
 
+/**
+ * Derived classes that can evaluate the energy of a group that is *not* part of
+ * `Space` without modifying any state (e.g. Widom ghost insertion on several
+ * threads) should override this. The group is assumed to be activated in the
+ * current configuration, i.e. the returned energy is that of a `Change` where
+ * the group is inserted.
+ *
+ * @throws std::logic_error if not implemented for the energy term
+ */
+double Energybase::ghostEnergy(const Group<Particle> &) const {
+    throw std::logic_error(name + ": energy of ghost groups not implemented");
+}
+
 void to_json(json &j, const Energybase &base) {
     assert(not base.name.empty());
-    if (base.timer)
+    if (base.timer) {
         j[base.name]["relative time"] = base.timer.result();
+        j[base.name]["time (s)"] = base.timer.seconds();
+        j[base.name]["calls"] = base.timer.calls();
+    }
     if (not base.citation_information.empty())
         j[base.name]["reference"] = base.citation_information;
     base.to_json(j[base.name]);
@@ -71,13 +87,31 @@ ExternalPotential::ExternalPotential(const json &j, Space &spc) : space(spc) {
 double ExternalPotential::energy(Change &change) {
     assert(externalPotentialFunc != nullptr);
     double energy = 0.0;
-    if (change.dV or change.all or change.dN) {
+    if (change.dV or change.all) {
         for (auto &group : space.groups) { // loop over all groups
             energy += groupEnergy(group);
             if (not std::isfinite(energy)) {
                 break; // stop summing if not finite
             }
         }
+    } else if (change.dN) {
+        // as in `Nonbonded::energySpeciation`, only *active* particles among the changed
+        // ones are summed; removed particles are accounted for in the other (old) space
+        for (auto &group_change : change.groups) {
+            auto &group = space.groups.at(group_change.index);
+            if (group_change.all or act_on_mass_center) {
+                energy += groupEnergy(group); // groupEnergy checks for molecule id and active particles
+            } else if (molecule_ids.find(group.id) != molecule_ids.end()) {
+                for (int index : group_change.atoms) {
+                    if (index < static_cast<int>(group.size())) {
+                        energy += externalPotentialFunc(group[index]);
+                    }
+                }
+            }
+            if (not std::isfinite(energy)) {
+                break; // stop summing if not finite
+            }
+        }
     } else {
         for (auto &group_change : change.groups) {             // loop over all changed groups
             auto &group = space.groups.at(group_change.index); // check specified groups
@@ -97,6 +131,17 @@ double ExternalPotential::energy(Change &change) {
     }
     return energy; // in kT
 }
+/**
+ * @param ghost Group not stored in Space
+ * @return External energy of the ghost group in kT
+ *
+ * Relies on `externalPotentialFunc` being safe to call concurrently.
+ */
+double ExternalPotential::ghostEnergy(const Group<Particle> &ghost) const {
+    assert(externalPotentialFunc != nullptr);
+    return groupEnergy(ghost);
+}
+
 void ExternalPotential::to_json(json &j) const {
     j["molecules"] = molecule_names;
     j["com"] = act_on_mass_center;
@@ -353,15 +398,87 @@ CustomExternal::CustomExternal(const json &j, Space &spc) : ExternalPotential(j,
         expr->set(
             j,
             {{"q", &particle_data.charge}, {"x", &particle_data.x}, {"y", &particle_data.y}, {"z", &particle_data.z}});
+        if (auto it = j.find("tabulate"); it != j.end()) {
+            createTables(*it);
+        }
         externalPotentialFunc = [&](const Particle &a) {
-            particle_data.x = a.pos.x();
-            particle_data.y = a.pos.y();
-            particle_data.z = a.pos.z();
-            particle_data.charge = a.charge;
-            return expr->operator()();
+            if (!tables.empty() && a.charge == Faunus::atoms[a.id].charge) {
+                const auto &table = tables[a.id];
+                const double x = a.pos[tabulation_axis] - tabulation_offset;
+                if (x > table.rmin2 && x <= table.rmax2) {
+                    return spline.eval(table, x);
+                }
+            }
+            return evaluate(a.charge, a.pos);
         };
     }
 }
+
+double CustomExternal::evaluate(double charge, const Point &position) {
+    particle_data.x = position.x();
+    particle_data.y = position.y();
+    particle_data.z = position.z();
+    particle_data.charge = charge;
+    return expr->operator()();
+}
+
+/**
+ * The expression is splined along a single axis in the interval [`min`,`max`], by
+ * default spanning the simulation box. As the table argument must be positive, the
+ * coordinate is shifted by `tabulation_offset`. The expression is probed at the box
+ * corners to ensure that it does not depend on the remaining coordinates.
+ */
+void CustomExternal::createTables(const json &j) {
+    const std::map<std::string, int> axes = {{"x", 0}, {"y", 1}, {"z", 2}};
+    if (auto it = axes.find(j.at("axis").get<std::string>()); it != axes.end()) {
+        tabulation_axis = it->second;
+    } else {
+        throw ConfigurationError(name + ": tabulation axis must be x, y, or z");
+    }
+    const Point half_box = 0.5 * space.geo.getLength();
+    const double min = j.value("min", -half_box[tabulation_axis]);
+    const double max = j.value("max", half_box[tabulation_axis]);
+    if (min >= max) {
+        throw ConfigurationError(name + ": tabulation requires min < max");
+    }
+    const double utol = j.value("utol", 1e-3);
+    spline.setTolerance(utol, j.value("ftol", 1e-2));
+    tabulation_offset = min - 1.0; // table arguments in [1, max - min + 1]
+
+    tables.resize(Faunus::atoms.size());
+    for (const auto &atom : Faunus::atoms) {
+        if (atom.implicit) {
+            continue;
+        }
+        auto expression = [&](double x) {
+            Point position = Point::Zero();
+            position[tabulation_axis] = x + tabulation_offset;
+            return evaluate(atom.charge, position);
+        };
+        for (double x = 1.0; x <= max - min + 1.0; x += 0.1 * (max - min)) { // probe other coordinates
+            for (const Point corner : {half_box, Point(-half_box)}) {
+                Point position = corner;
+                position[tabulation_axis] = x + tabulation_offset;
+                if (std::fabs(evaluate(atom.charge, position) - expression(x)) > utol) {
+                    throw ConfigurationError(name + ": tabulated expression may depend on a single coordinate only");
+                }
+            }
+        }
+        tables.at(atom.id()) = spline.generate(expression, 1.0, max - min + 1.0);
+        faunus_logger->debug("{}: {} tabulated using {} knots", name, atom.name, tables.at(atom.id()).numKnots());
+    }
+}
+/**
+ * Expressions share a single set of bound variables (`particle_data`) and are
+ * therefore not safe to evaluate concurrently.
+ */
+double CustomExternal::ghostEnergy(const Group<Particle> &ghost) const {
+    if (expr) {
+        throw std::logic_error(name + ": expressions cannot be evaluated for ghost groups");
+    }
+    return ExternalPotential::ghostEnergy(ghost);
+}
+
 void CustomExternal::to_json(json &j) const {
     j = json_input_backup;
     ExternalPotential::to_json(j);
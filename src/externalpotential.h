@@ -2,6 +2,7 @@
 
 #include "group.h"
 #include "auxiliary.h"
+#include "tabulate.h"
 #include <set>
 
 template<typename T> class ExprFunction;
@@ -28,6 +29,7 @@ class Energybase {
     virtual void sync(Energybase *, Change &);
     virtual void init();                                  //!< reset and initialize
     virtual inline void force(PointVector &){};           //!< update forces on all particles
+    virtual double ghostEnergy(const Group<Particle> &) const; //!< energy of a group not stored in Space
     inline virtual ~Energybase() = default;
 };
 
@@ -40,7 +42,8 @@ void to_json(json &j, const Energybase &base); //!< Converts any energy class to
  * atoms or the mass-center. The specific energy function, `externalPotentialFunc`
  * is defined in derived classes.
  *
- * @todo The `dN` check is inefficient as it calculates the external potential on *all* particles.
+ * For volume changes, or if everything changed, the external potential is evaluated on *all*
+ * particles, while for particle number changes (`dN`) only the changed groups and atoms are visited.
  */
 class ExternalPotential : public Energybase {
   private:
@@ -54,6 +57,7 @@ class ExternalPotential : public Energybase {
   public:
     ExternalPotential(const json &, Space &);
     double energy(Change &) override;
+    double ghostEnergy(const Group<Particle> &) const override;
     void to_json(json &) const override;
 };
 
@@ -72,6 +76,11 @@ std::function<double(const Particle &)> createGouyChapmanPotential(const json &j
 
 /**
  * @brief Custom external potential on molecules
+ *
+ * If the expression depends on a single Cartesian coordinate only, it can be splined
+ * along this axis for each atom type at start-up (`tabulate`). The expression is then
+ * evaluated only outside the tabulated interval, or if a particle charge differs from
+ * that of its atom type.
  */
 class CustomExternal : public ExternalPotential {
   private:
@@ -81,9 +90,16 @@ class CustomExternal : public ExternalPotential {
     };
     ParticleData particle_data;
     json json_input_backup; // initial json input
+    int tabulation_axis = 2;                                  //!< Axis along which the expression is tabulated
+    double tabulation_offset = 0.0;                           //!< Coordinate shift to make table arguments positive
+    Tabulate::Andrea<double> spline;                          //!< Spline method
+    std::vector<Tabulate::TabulatorBase<double>::data> tables; //!< Tabulated expression for each atom type
+    double evaluate(double charge, const Point &position);     //!< Evaluate expression
+    void createTables(const json &);                           //!< Spline expression for all atom types
 
   public:
     CustomExternal(const json &, Space &);
+    double ghostEnergy(const Group<Particle> &) const override;
     void to_json(json &) const override;
 };
 
@@ -30,6 +30,59 @@ TEST_CASE("[Faunus] ExternalPotential") {
     }
 }
 
+TEST_CASE("[Faunus] ExternalPotential - insertion and deletion") {
+    // for dN changes only the changed particles are summed; this must match the change in total energy
+    Faunus::atoms = R"([ {"A": {"sigma": 2.0}}, {"B": {"sigma": 3.0}} ])"_json.get<decltype(atoms)>();
+    Faunus::molecules = R"([
+        { "salt": { "atoms": ["A", "B"], "atomic": true } },
+        { "dimer": { "rigid": true, "structure": [ {"A": [0.0, 0.0, 0.0]}, {"B": [3.0, 0.0, 0.0]} ] } }
+    ])"_json.get<decltype(molecules)>();
+    json j = R"({
+        "geometry": {"type": "cuboid", "length": 50 },
+        "insertmolecules": [ {"salt": {"N": 5}}, {"dimer": {"N": 2}}, {"dimer": {"N": 1, "inactive": true}} ]
+    })"_json;
+    Space spc = j;
+    REQUIRE(spc.groups.size() == 4);
+    ParticleSelfEnergy pot(spc, [](const Particle &particle) { return particle.pos.z() + particle.id + 1.0; });
+
+    Change everything;
+    everything.all = true;
+    auto changeOf = [](int group_index, const std::vector<int> &atoms, bool all) {
+        Change change;
+        change.dN = true;
+        Change::data change_data;
+        change_data.index = group_index;
+        change_data.all = all;
+        change_data.internal = true;
+        change_data.atoms = atoms;
+        change.groups.push_back(change_data);
+        return change;
+    };
+
+    SUBCASE("Atomic group") {
+        auto &salt = spc.groups.at(0);
+        auto change = changeOf(0, {static_cast<int>(salt.size()) - 1}, false);
+        const double energy_before = pot.energy(everything);
+        const double deletion = pot.energy(change); // old space: the particle is still active
+        salt.deactivate(salt.end() - 1, salt.end());
+        const double energy_after = pot.energy(everything);
+        CHECK(deletion == Approx(energy_before - energy_after));
+        CHECK(pot.energy(change) == 0.0); // new space: removed particles are not counted
+
+        salt.activate(salt.end(), salt.end() + 1);
+        CHECK(pot.energy(change) == Approx(pot.energy(everything) - energy_after)); // insertion
+    }
+
+    SUBCASE("Molecular group") {
+        auto &dimer = spc.groups.at(3);
+        auto change = changeOf(3, {0, 1}, true);
+        const double energy_before = pot.energy(everything);
+        CHECK(pot.energy(change) == 0.0); // old space: the molecule is inactive
+        dimer.activate(dimer.end(), dimer.trueend());
+        CHECK(pot.energy(change) == Approx(pot.energy(everything) - energy_before)); // insertion
+    }
+}
+
 TEST_CASE("[Faunus] Gouy-Chapman") {
     Geometry::Slit slit(50, 50, 50);
     Geometry::Chameleon geometry(slit, Geometry::SLIT);
@@ -3,6 +3,7 @@
 #include "move.h"
 #include "montecarlo.h"
 #include "analysis.h"
+#include "energy.h"
 #include "multipole.h"
 #include "docopt.h"
 #include "progress_tracker.h"
@@ -41,14 +42,16 @@ static const char USAGE[] =
     https://faunus.readthedocs.io
 
     Usage:
-      faunus [-q] [--verbosity <N>] [--nobar] [--nopfx] [--notips] [--nofun] [--state=<file>] [--input=<file>] [--output=<file>]
+      faunus [-q] [--verbosity <N>] [--nobar] [--nopfx] [--notips] [--nofun] [--state=<file>] [--rerun=<file>] [--trace=<file>] [--input=<file>] [--output=<file>]
       faunus (-h | --help)
       faunus --version
 
     Options:
       -i <file> --input <file>   Input file [default: /dev/stdin].
       -o <file> --output <file>  Output file [default: out.json].
-      -s <file> --state <file>   State file to start from (.json/.ubj).
+      -s <file> --state <file>   State file to start from (.json/.ubj/.cpt).
+      -r <file> --rerun <file>   Replay space trajectory (.traj/.ztraj/.itraj) instead of simulating.
+      -t <file> --trace <file>   Write timeline of all moves in Chrome trace format (.json).
       -v <N> --verbosity <N>     Log verbosity level (0 = off, 1 = critical, ..., 6 = trace) [default: 4]
       -q --quiet                 Less verbose output. It implicates -v0 --nobar --notips --nofun.
       -h --help                  Show this screen.
@@ -69,6 +72,7 @@ using ProgressIndicator::ProgressTracker;
 
 // forward declarations
 std::shared_ptr<ProgressTracker> createProgressTracker(bool, unsigned int);
+json rerunTrajectory(const std::string &, MetropolisMonteCarlo &, Analysis::CombinedAnalysis &);
 
 int main(int argc, char **argv) {
     using namespace Faunus::MPI;
@@ -157,9 +161,14 @@ int main(int argc, char **argv) {
                 auto mode = std::ios::in;
                 if (binary) {
                     mode = std::ifstream::ate | std::ios::binary; // ate = open at end
+                } else if (suffix == "cpt") {
+                    mode = std::ios::in | std::ios::binary;
                 }
                 f.open(state, mode);
-                if (f) {
+                if (f && suffix == "cpt") { // binary checkpoint is streamed directly into the simulation
+                    faunus_logger->info("loading checkpoint file {}", state);
+                    sim.restore(f);
+                } else if (f) {
                     json j;
                     faunus_logger->info("loading state file {}", state);
                     if (binary) {
@@ -185,37 +194,52 @@ int main(int argc, char **argv) {
                 }
             }
 
-            Analysis::CombinedAnalysis analysis(json_in.at("analysis"), sim.getSpace(), sim.getHamiltonian());
+            Analysis::CombinedAnalysis analysis(json_in.at("analysis"), sim.getSpace(), sim.getHamiltonian(),
+                                                &sim.getMoves());
 
-            auto &loop = json_in.at("mcloop");
-            int macro = loop.at("macro");
-            int micro = loop.at("micro");
+            // --trace
+            if (args["--trace"]) {
+                sim.setTrace(Faunus::MPI::prefix + args["--trace"].asString());
+            }
 
-            auto progress_tracker = createProgressTracker(show_progress, macro * micro);
-            for (int i = 0; i < macro; i++) {
-                for (int j = 0; j < micro; j++) {
-                    if (progress_tracker && mpi.isMaster()) {
-                        if(++(*progress_tracker) % 10 == 0) {
-                            progress_tracker->display();
+            json rerun_info;
+            if (args["--rerun"]) { // --rerun
+                rerun_info = rerunTrajectory(Faunus::MPI::prefix + args["--rerun"].asString(), sim, analysis);
+            } else {
+                auto &loop = json_in.at("mcloop");
+                int macro = loop.at("macro");
+                int micro = loop.at("micro");
+
+                auto progress_tracker = createProgressTracker(show_progress, macro * micro);
+                for (int i = 0; i < macro; i++) {
+                    for (int j = 0; j < micro; j++) {
+                        if (progress_tracker && mpi.isMaster()) {
+                            if(++(*progress_tracker) % 10 == 0) {
+                                progress_tracker->display();
+                            }
                         }
-                    }
-                    sim.move();
-                    analysis.sample();
-                }                   // end of micro steps
-                analysis.to_disk(); // save analysis to disk
-            }                       // end of macro steps
-            if (progress_tracker && mpi.isMaster()) {
-                progress_tracker->done();
-            }
+                        sim.move();
+                        analysis.sample();
+                    }                   // end of micro steps
+                    analysis.to_disk(); // save analysis to disk
+                }                       // end of macro steps
+                if (progress_tracker && mpi.isMaster()) {
+                    progress_tracker->done();
+                }
 
-            faunus_logger->log((sim.relativeEnergyDrift() < 1E-9) ? spdlog::level::info : spdlog::level::warn,
-                               "relative energy drift = {}", sim.relativeEnergyDrift());
+                faunus_logger->log((sim.relativeEnergyDrift() < 1E-9) ? spdlog::level::info : spdlog::level::warn,
+                                   "relative energy drift = {}", sim.relativeEnergyDrift());
+            }
 
             // --output
             if (std::ofstream file(Faunus::MPI::prefix + args["--output"].asString()); file) {
                 json j;
-                Faunus::to_json(j, sim);
-                j["relative drift"] = sim.relativeEnergyDrift();
+                if (rerun_info.empty()) {
+                    Faunus::to_json(j, sim);
+                    j["relative drift"] = sim.relativeEnergyDrift();
+                } else {
+                    j["rerun"] = rerun_info;
+                }
                 j["analysis"] = analysis;
                 if (mpi.nproc() > 1) {
                     j["mpi"] = mpi;
@@ -327,6 +351,45 @@ std::shared_ptr<CPPSID::Player> createLoadedSIDplayer() {
 }
 #endif
 
+/**
+ * @brief Replay a space trajectory through the Hamiltonian and analysis
+ *
+ * Particles and groups of each frame are copied into the accepted state of the
+ * simulation, followed by an energy evaluation and an analysis sample event.
+ * The geometry is taken from the input. For sequential trajectories the next
+ * frame is read in the background while a frame is being processed.
+ *
+ * @param filename Trajectory file (.traj/.ztraj/.itraj)
+ * @return json object with rerun information
+ */
+json rerunTrajectory(const std::string &filename, MetropolisMonteCarlo &sim, Analysis::CombinedAnalysis &analysis) {
+    faunus_logger->info("rerunning trajectory {}", filename);
+    Change change;
+    change.all = true;
+    Average<double> energy;
+    auto process_frame = [&] {
+        energy += sim.getHamiltonian().energy(change);
+        analysis.sample();
+    };
+    if (filename.substr(filename.find_last_of(".") + 1) == "itraj") { // frame-indexed trajectory
+        IndexedSpaceTrajectoryReader reader(filename);
+        for (size_t i = 0; i < reader.size(); i++) {
+            reader.load(i, sim.getSpace());
+            process_frame();
+        }
+    } else {
+        SpaceTrajectoryReader reader(filename, sim.getSpace());
+        while (reader.read(sim.getSpace())) {
+            process_frame();
+        }
+    }
+    analysis.to_disk();
+    if (energy.empty()) {
+        faunus_logger->warn("no frames found in {}", filename);
+    }
+    return {{"file", filename}, {"frames", energy.cnt}, {"average potential energy (kT)", energy.avg()}};
+}
+
 std::shared_ptr<ProgressTracker> createProgressTracker(bool show_progress, unsigned int steps) {
     using namespace ProgressIndicator;
     using namespace std::chrono;
@@ -16,6 +16,99 @@ GeometryBase::~GeometryBase() = default;
 
 GeometryImplementation::~GeometryImplementation() = default;
 
+// =============== Triclinic Cell ===============
+
+TriclinicCell::TriclinicCell(const Eigen::Matrix3d &vectors) { setVectors(vectors); }
+
+void TriclinicCell::setVectors(const Eigen::Matrix3d &new_vectors) {
+    vectors = new_vectors;
+    shifts.clear();
+    if (std::fabs(vectors.determinant()) < pc::epsilon_dbl) { // empty cell, e.g. before configuration
+        inverse.setZero();
+        extent.setZero();
+        return;
+    }
+    inverse = vectors.inverse();
+    for (int i = -1; i <= 1; i++) {
+        for (int j = -1; j <= 1; j++) {
+            for (int k = -1; k <= 1; k++) {
+                const Point shift = vectors * Point(i, j, k);
+                const double tolerance = 1e-10 * shift.squaredNorm(); // rejects e.g. all shifts of orthogonal cells
+                if ((vectors.transpose() * shift).cwiseAbs().sum() > shift.squaredNorm() + tolerance) {
+                    shifts.push_back(shift);
+                }
+            }
+        }
+    }
+    updateExtent();
+}
+
+const Eigen::Matrix3d &TriclinicCell::getVectors() const { return vectors; }
+
+double TriclinicCell::getVolume() const { return std::fabs(vectors.determinant()); }
+
+Point TriclinicCell::getLength() const { return extent; }
+
+/**
+ * The extent of the Wigner-Seitz cell is found from its vertices, i.e. from all intersections of three
+ * planes bisecting the lattice translations to the nearest 26 cells that lie within the cell.
+ */
+void TriclinicCell::updateExtent() {
+    std::vector<Point> translations;
+    for (int i = -1; i <= 1; i++) {
+        for (int j = -1; j <= 1; j++) {
+            for (int k = -1; k <= 1; k++) {
+                if (i != 0 || j != 0 || k != 0) {
+                    translations.push_back(vectors * Point(i, j, k));
+                }
+            }
+        }
+    }
+    auto is_inside = [&](const Point &a) {
+        return std::all_of(translations.begin(), translations.end(), [&](const auto &t) {
+            return a.dot(t) <= 0.5 * t.squaredNorm() * (1.0 + 1e-9);
+        });
+    };
+    Point half_length = Point::Zero();
+    for (size_t i = 0; i < translations.size(); i++) {
+        for (size_t j = i + 1; j < translations.size(); j++) {
+            for (size_t k = j + 1; k < translations.size(); k++) {
+                Eigen::Matrix3d planes;
+                planes << translations[i].transpose(), translations[j].transpose(), translations[k].transpose();
+                if (std::fabs(planes.determinant()) > 1e-9 * std::pow(planes.norm(), 3)) {
+                    const Point b = 0.5 * Point(translations[i].squaredNorm(), translations[j].squaredNorm(),
+                                                translations[k].squaredNorm());
+                    const Point vertex = planes.partialPivLu().solve(b);
+                    if (is_inside(vertex)) {
+                        half_length = half_length.cwiseMax(vertex.cwiseAbs());
+                    }
+                }
+            }
+        }
+    }
+    extent = 2.0 * half_length;
+}
+
+TriclinicCell TriclinicCell::hexagonalPrism(double inner_diameter, double height) {
+    Eigen::Matrix3d vectors;
+    vectors.col(0) = Point(inner_diameter, 0.0, 0.0);
+    vectors.col(1) = Point(0.5 * inner_diameter, 0.5 * std::sqrt(3.0) * inner_diameter, 0.0);
+    vectors.col(2) = Point(0.0, 0.0, height);
+    return TriclinicCell(vectors);
+}
+
+/**
+ * The truncated octahedron is the Wigner-Seitz cell of the body-centered cubic lattice
+ * with square faces perpendicular to the Cartesian axes.
+ */
+TriclinicCell TriclinicCell::truncatedOctahedron(double square_face_distance) {
+    Eigen::Matrix3d vectors;
+    vectors.col(0) = 0.5 * square_face_distance * Point(-1.0, 1.0, 1.0);
+    vectors.col(1) = 0.5 * square_face_distance * Point(1.0, -1.0, 1.0);
+    vectors.col(2) = 0.5 * square_face_distance * Point(1.0, 1.0, -1.0);
+    return TriclinicCell(vectors);
+}
+
 // =============== Cuboid ===============
 
 Cuboid::Cuboid(const Point &p) {
@@ -561,6 +654,91 @@ void TruncatedOctahedron::from_json(const json &j) { side = j.at("radius").get<d
 
 void TruncatedOctahedron::to_json(json &j) const { j = {{"radius", side}}; }
 
+// =============== Triclinic ===============
+
+Triclinic::Triclinic(const Eigen::Matrix3d &vectors) : cell(vectors) {
+    boundary_conditions = BoundaryCondition(TRICLINIC_CELL, {PERIODIC, PERIODIC, PERIODIC});
+}
+
+Point Triclinic::getLength() const { return cell.getLength(); }
+
+double Triclinic::getVolume(int) const { return cell.getVolume(); }
+
+Point Triclinic::setVolume(double volume, const VolumeMethod method) {
+    const double old_volume = getVolume();
+    double alpha;
+    Point box_scaling;
+    switch (method) {
+    case ISOTROPIC:
+        alpha = std::cbrt(volume / old_volume);
+        box_scaling = {alpha, alpha, alpha};
+        break;
+    case XY:
+        alpha = std::sqrt(volume / old_volume);
+        box_scaling = {alpha, alpha, 1.0};
+        break;
+    case Z:
+        alpha = volume / old_volume;
+        box_scaling = {1.0, 1.0, alpha};
+        break;
+    case ISOCHORIC:
+        alpha = std::cbrt(volume / old_volume);
+        box_scaling = {alpha, alpha, 1 / (alpha * alpha)};
+        volume = old_volume;
+        break;
+    default:
+        throw std::invalid_argument("unsupported volume scaling method for the triclinic geometry");
+    }
+    cell.setVectors(box_scaling.asDiagonal() * cell.getVectors()); // scale Cartesian components of cell vectors
+    assert(std::fabs(getVolume() - volume) < 1e-6);
+    return box_scaling;
+}
+
+Point Triclinic::vdist(const Point &a, const Point &b) const {
+    Point distance(a - b);
+    cell.minimumImage(distance);
+    return distance;
+}
+
+void Triclinic::boundary(Point &a) const { cell.minimumImage(a); }
+
+bool Triclinic::collision(const Point &a) const {
+    Point image(a);
+    cell.minimumImage(image);
+    return image.squaredNorm() < a.squaredNorm() * (1.0 - 1e-12); // a periodic image is closer to the origin
+}
+
+/**
+ * A uniform point in the parallelepiped spanned by the cell vectors is mapped
+ * into the Wigner-Seitz cell, which preserves uniformity.
+ */
+void Triclinic::randompos(Point &m, Random &rand) const {
+    m = cell.getVectors() * Point(rand() - 0.5, rand() - 0.5, rand() - 0.5);
+    cell.minimumImage(m);
+}
+
+void Triclinic::from_json(const json &j) {
+    const auto &rows = j.at("vectors");
+    if (!rows.is_array() || rows.size() != 3) {
+        throw std::runtime_error("three cell vectors required");
+    }
+    Eigen::Matrix3d vectors;
+    for (int i = 0; i < 3; i++) {
+        vectors.col(i) = rows.at(i).get<Point>();
+    }
+    if (std::fabs(vectors.determinant()) < pc::epsilon_dbl) {
+        throw std::runtime_error("cell vectors must be linearly independent");
+    }
+    cell.setVectors(vectors);
+}
+
+void Triclinic::to_json(json &j) const {
+    const auto &vectors = cell.getVectors();
+    j = {{"vectors", {Point(vectors.col(0)), Point(vectors.col(1)), Point(vectors.col(2))}}};
+}
+
+const TriclinicCell &Triclinic::getCell() const { return cell; }
+
 // =============== Chameleon==============
 
 const std::map<std::string, Variant> Chameleon::names = {{
@@ -570,7 +748,8 @@ const std::map<std::string, Variant> Chameleon::names = {{
     {"sphere", SPHERE},
     {"hexagonal", HEXAGONAL},
     {"octahedron", OCTAHEDRON},
-    {"hypersphere2d", HYPERSPHERE2D}
+    {"hypersphere2d", HYPERSPHERE2D},
+    {"triclinic", TRICLINIC}
 }};
 
 void from_json(const json &j, Chameleon &g) {
@@ -659,6 +838,9 @@ void Chameleon::makeGeometry(const Variant type) {
     case HYPERSPHERE2D:
         geometry = std::make_unique<Hypersphere2d>();
         break;
+    case TRICLINIC:
+        geometry = std::make_unique<Triclinic>();
+        break;
     default:
         throw std::invalid_argument("unknown geometry");
     }
@@ -690,6 +872,26 @@ void Chameleon::_setLength(const Point &l) {
     if (geometry->boundary_conditions.coordinates == ORTHOGONAL)
         for (size_t i = 0; i < 3; i++)
             len_or_zero[i] = len[i] * (geometry->boundary_conditions.direction[i] == PERIODIC);
+
+    // non-orthogonal periodic geometries share the inlined minimum image of their lattice
+    use_cell = true;
+    switch (geometry->boundary_conditions.coordinates) {
+    case ORTHOHEXAGONAL:
+        cell = TriclinicCell::hexagonalPrism(l.x(), l.z());
+        break;
+    case TRUNC_OCTAHEDRAL:
+        cell = TriclinicCell::truncatedOctahedron(l.x());
+        break;
+    case TRICLINIC_CELL:
+        cell = dynamic_cast<const Triclinic &>(*geometry).getCell();
+        break;
+    default:
+        use_cell = false;
+    }
+}
+
+bool Chameleon::isSkewed() const {
+    return type == TRICLINIC && !dynamic_cast<const Triclinic &>(*geometry).getCell().getVectors().isDiagonal(1e-12);
 }
 
 double Chameleon::getVolume(int dim) const {
@@ -720,6 +922,8 @@ Chameleon &Chameleon::operator=(const Chameleon &geo) {
         len_half = geo.len_half;
         len_inv = geo.len_inv;
         len_or_zero = geo.len_or_zero;
+        cell = geo.cell;
+        use_cell = geo.use_cell;
         _type = geo._type;
         _name = geo._name;
         geometry = geo.geometry != nullptr ? geo.geometry->clone() : nullptr;
@@ -730,8 +934,8 @@ Chameleon &Chameleon::operator=(const Chameleon &geo) {
 const BoundaryCondition &Chameleon::boundaryConditions() const { return geometry->boundary_conditions; }
 
 Chameleon::Chameleon(const Chameleon &geo)
-    : GeometryBase(geo), len(geo.len), len_half(geo.len_half), len_inv(geo.len_inv),
-      geometry(geo.geometry != nullptr ? geo.geometry->clone() : nullptr), _type(geo._type), _name(geo._name) {}
+    : GeometryBase(geo), len_or_zero(geo.len_or_zero), len(geo.len), len_half(geo.len_half), len_inv(geo.len_inv),
+      cell(geo.cell), use_cell(geo.use_cell), geometry(geo.geometry != nullptr ? geo.geometry->clone() : nullptr), _type(geo._type), _name(geo._name) {}
 
 } // namespace Geometry
 } // namespace Faunus
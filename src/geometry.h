@@ -32,7 +32,7 @@ typedef std::function<void(Point &)> BoundaryFunction;
 typedef std::function<Point(const Point &, const Point &)> DistanceFunction;
 
 //! Geometry variant used for Chameleon.
-enum Variant { CUBOID = 0, SPHERE, CYLINDER, SLIT, HEXAGONAL, OCTAHEDRON, HYPERSPHERE2D };
+enum Variant { CUBOID = 0, SPHERE, CYLINDER, SLIT, HEXAGONAL, OCTAHEDRON, HYPERSPHERE2D, TRICLINIC };
 
 //! Various methods of volume scaling, @see GeometryBase::setVolume.
 enum VolumeMethod { ISOTROPIC, ISOCHORIC, XY, Z, INVALID };
@@ -43,7 +43,7 @@ NLOHMANN_JSON_SERIALIZE_ENUM(VolumeMethod, {{VolumeMethod::INVALID, nullptr},
                                             {VolumeMethod::XY, "xy"},
                                             {VolumeMethod::Z, "z"}})
 
-enum Coordinates { ORTHOGONAL, ORTHOHEXAGONAL, TRUNC_OCTAHEDRAL, NON3D };
+enum Coordinates { ORTHOGONAL, ORTHOHEXAGONAL, TRUNC_OCTAHEDRAL, NON3D, TRICLINIC_CELL };
 enum Boundary { FIXED, PERIODIC };
 
 /**
@@ -67,6 +67,72 @@ struct BoundaryCondition {
         : coordinates(coordinates), direction(boundary){};
 };
 
+/**
+ * @brief Orthogonal boundary conditions known at compile time
+ *
+ * Used to specialise time-critical distance calculations for a fixed geometry so that
+ * the compiler can drop the run-time tests of the boundary conditions, see Chameleon::vdist<>().
+ */
+template <bool periodic_x, bool periodic_y, bool periodic_z> struct OrthogonalBoundary {
+    static constexpr bool x = periodic_x, y = periodic_y, z = periodic_z;
+};
+typedef OrthogonalBoundary<true, true, true> CuboidBoundary; //!< Periodic in all directions
+typedef OrthogonalBoundary<true, true, false> SlitBoundary;  //!< Periodic in x and y
+typedef OrthogonalBoundary<false, false, false> OpenBoundary; //!< No periodicity
+struct RuntimeBoundary {}; //!< Boundary conditions are tested at run time
+
+/**
+ * @brief Minimum image convention for a periodic lattice spanned by three, possibly non-orthogonal, vectors
+ *
+ * A distance vector is first reduced in fractional coordinates, and then compared against a short list
+ * of lattice translations that may shorten it further. The list is built once for the cell: a translation
+ * `t` is kept only if it can shorten some reduced vector, i.e. if @f$ \sum_k |(H^T t)_k| > t^2 @f$ where
+ * the columns of @f$ H @f$ are the cell vectors. The list is empty for orthogonal cells, and holds twelve
+ * translations for the hexagonal prism and for the truncated octahedron. The resulting image is the
+ * shortest one for cells that are not extremely skewed, i.e. that are reduced such that the
+ * neighbouring lattice points are found among the nearest 26 cells.
+ */
+class TriclinicCell {
+    Eigen::Matrix3d vectors = Eigen::Matrix3d::Zero(); //!< Cell vectors as columns
+    Eigen::Matrix3d inverse = Eigen::Matrix3d::Zero(); //!< Inverse of `vectors`
+    std::vector<Point> shifts;                         //!< Lattice translations that may shorten a reduced vector
+    Point extent = {0, 0, 0};                          //!< Sides of the box containing the Wigner-Seitz cell
+    void updateExtent();
+
+  public:
+    TriclinicCell() = default;
+    explicit TriclinicCell(const Eigen::Matrix3d &vectors);
+    void setVectors(const Eigen::Matrix3d &vectors); //!< Set cell vectors (columns)
+    const Eigen::Matrix3d &getVectors() const;        //!< Cell vectors (columns)
+    double getVolume() const;                         //!< Cell volume
+    Point getLength() const;                          //!< Sides of the box containing the Wigner-Seitz cell
+    inline void minimumImage(Point &distance) const;  //!< Replace vector with its shortest periodic image
+    static TriclinicCell hexagonalPrism(double inner_diameter, double height); //!< Lattice of HexagonalPrism
+    static TriclinicCell truncatedOctahedron(double square_face_distance);    //!< Lattice of TruncatedOctahedron
+};
+
+/**
+ * Branch-light: rounding is done on all three fractional coordinates at once,
+ * and the translation search merely selects the shortest candidate.
+ */
+inline void TriclinicCell::minimumImage(Point &distance) const {
+    const Point translation = (inverse * distance).array().round().matrix();
+    distance -= vectors * translation;
+    if (!shifts.empty()) {
+        Point shortest = distance;
+        double shortest_squared = distance.squaredNorm();
+        for (const auto &shift : shifts) {
+            const Point trial = distance + shift;
+            const double trial_squared = trial.squaredNorm();
+            if (trial_squared < shortest_squared) {
+                shortest = trial;
+                shortest_squared = trial_squared;
+            }
+        }
+        distance = shortest;
+    }
+}
+
 /**
  * @brief An interface for all geometries.
  */
@@ -302,13 +368,50 @@ class TruncatedOctahedron : public GeometryImplementation {
 };
 
 /**
- * @brief Geometry class for spheres, cylinders, cuboids, hexagonal prism, truncated octahedron, slits. It is
- * a wrapper of a concrete geometry implementation.
+ * @brief A periodic cell spanned by three, possibly non-orthogonal, vectors a, b, and c.
+ *
+ * Positions are kept within the Wigner-Seitz cell of the lattice, i.e. the region closer to the origin than to
+ * any other lattice point. For instance, the lattice with vectors (-L,L,L)/2, (L,-L,L)/2, and (L,L,-L)/2 gives
+ * a truncated octahedron, while (L,0,0), (L/2,L√3/2,0), and (0,0,h) gives a hexagonal prism. The cell vectors
+ * should be reduced, i.e. as short and as orthogonal as possible, see TriclinicCell.
+ */
+class Triclinic : public GeometryImplementation {
+    TriclinicCell cell;
+
+  public:
+    Point getLength() const override;
+    double getVolume(int dim = 3) const override;
+    Point setVolume(double volume, VolumeMethod method = ISOTROPIC) override;
+    Point vdist(const Point &a, const Point &b) const override;
+    void boundary(Point &a) const override;
+    bool collision(const Point &a) const override;
+    void randompos(Point &m, Random &rand) const override;
+    void from_json(const json &j) override;
+    void to_json(json &j) const override;
+    const TriclinicCell &getCell() const; //!< Lattice of the cell
+    Triclinic(const Eigen::Matrix3d &vectors = Eigen::Matrix3d::Zero()); //!< Cell vectors as columns
+
+    std::unique_ptr<GeometryImplementation> clone() const override {
+        return std::make_unique<Triclinic>(*this);
+    }; //!< A unique pointer to a copy of self.
+
+    //! Cereal serialisation
+    template <class Archive> void serialize(Archive &archive) {
+        Eigen::Matrix3d vectors = cell.getVectors();
+        archive(cereal::base_class<GeometryImplementation>(this), vectors);
+        cell.setVectors(vectors);
+    }
+};
+
+/**
+ * @brief Geometry class for spheres, cylinders, cuboids, hexagonal prism, truncated octahedron, triclinic cells,
+ * slits. It is a wrapper of a concrete geometry implementation.
  *
  * The class re-implements the time-critical functions vdist and boundary for the orthogonal periodic boundary
  * conditions. Hence the call can be inlined by the compiler. That would not be possible otherwise due to the
  * polymorphism of the concrete implementations. Other functions calls are delegated directly to the concrete
- * implementation.
+ * implementation. Likewise, the hexagonal prism, the truncated octahedron, and triclinic cells share an inlined
+ * minimum image of their lattice, see TriclinicCell.
  *
  * Note that the class implements a copy constructor and overloads the assignment operator.
  *
@@ -322,6 +425,8 @@ class Chameleon : public GeometryBase {
   private:
     Point len_or_zero = {0, 0, 0}; //!< Box length (if PBC) or zero (if no PBC) in given direction
     Point len, len_half, len_inv; //!< Cached box dimensions, their half-values, and reciprocal values.
+    TriclinicCell cell;             //!< Cached lattice of non-orthogonal periodic geometries
+    bool use_cell = false;          //!< True if the minimum image is found using `cell`
     std::unique_ptr<GeometryImplementation> geometry = nullptr; //!< A concrete geometry implementation.
     Variant _type;                                              //!< Type of concrete geometry.
     std::string _name;                                          //!< Name of concrete geometry, e.g., for json.
@@ -339,12 +444,16 @@ class Chameleon : public GeometryBase {
     void boundary(Point &) const override;                    //!< Apply boundary conditions
     Point vdist(const Point &, const Point &) const override; //!< (Minimum) distance between two points
     double sqdist(const Point &, const Point &) const;        //!< (Minimum) squared distance between two points
+    template <typename TBoundary> inline Point vdist(const Point &, const Point &) const;
+    template <typename TBoundary> inline double sqdist(const Point &, const Point &) const;
+    template <typename TBoundary> bool hasBoundary() const; //!< True if `TBoundary` matches the geometry
     void randompos(Point &, Random &) const override;
     bool collision(const Point &) const override;
     void from_json(const json &) override;
     void to_json(json &j) const override;
 
     const BoundaryCondition &boundaryConditions() const; //!< Get info on boundary conditions
+    bool isSkewed() const; //!< True for a triclinic cell with non-orthogonal cell vectors
 
     static const std::map<std::string, Variant> names; //!< Geometry names.
     typedef std::pair<std::string, Variant> VariantName;
@@ -388,6 +497,8 @@ inline void Chameleon::boundary(Point &a) const {
             if (std::fabs(a.z()) > len_half.z())
                 a.z() -= len.z() * anint(a.z() * len_inv.z());
         }
+    } else if (use_cell) {
+        cell.minimumImage(a);
     } else {
         geometry->boundary(a);
     }
@@ -416,6 +527,9 @@ inline Point Chameleon::vdist(const Point &a, const Point &b) const {
             else if (distance.z() < -len_half.z())
                 distance.z() += len.z();
         }
+    } else if (use_cell) {
+        distance = a - b;
+        cell.minimumImage(distance);
     } else {
         distance = geometry->vdist(a, b);
     }
@@ -438,10 +552,70 @@ inline double Chameleon::sqdist(const Point &a, const Point &b) const {
     if (geometry->boundary_conditions.coordinates == ORTHOGONAL) {
         Point d((a - b).cwiseAbs());
         return (d - (d.array() > len_half.array()).cast<double>().matrix().cwiseProduct(len_or_zero)).squaredNorm();
+    } else if (use_cell) {
+        Point d(a - b);
+        cell.minimumImage(d);
+        return d.squaredNorm();
     } else
         return geometry->vdist(a, b).squaredNorm();
 }
 
+/**
+ * Minimum distance for boundary conditions known at compile time. The caller is responsible
+ * for matching the geometry, see `hasBoundary()`.
+ *
+ * @tparam TBoundary OrthogonalBoundary or RuntimeBoundary
+ */
+template <typename TBoundary> inline Point Chameleon::vdist(const Point &a, const Point &b) const {
+    if constexpr (std::is_same<TBoundary, RuntimeBoundary>::value) {
+        return vdist(a, b);
+    } else {
+        assert(hasBoundary<TBoundary>());
+        Point distance(a - b);
+        if constexpr (TBoundary::x) {
+            distance.x() -= len.x() * anint(distance.x() * len_inv.x());
+        }
+        if constexpr (TBoundary::y) {
+            distance.y() -= len.y() * anint(distance.y() * len_inv.y());
+        }
+        if constexpr (TBoundary::z) {
+            distance.z() -= len.z() * anint(distance.z() * len_inv.z());
+        }
+        return distance;
+    }
+}
+
+template <typename TBoundary> inline double Chameleon::sqdist(const Point &a, const Point &b) const {
+    if constexpr (std::is_same<TBoundary, RuntimeBoundary>::value) {
+        return sqdist(a, b);
+    } else {
+        assert(hasBoundary<TBoundary>());
+        Point distance((a - b).cwiseAbs()); // as in `sqdist()`, casting faster than branching
+        if constexpr (TBoundary::x) {
+            distance.x() -= len.x() * static_cast<double>(distance.x() > len_half.x());
+        }
+        if constexpr (TBoundary::y) {
+            distance.y() -= len.y() * static_cast<double>(distance.y() > len_half.y());
+        }
+        if constexpr (TBoundary::z) {
+            distance.z() -= len.z() * static_cast<double>(distance.z() > len_half.z());
+        }
+        return distance.squaredNorm();
+    }
+}
+
+template <typename TBoundary> bool Chameleon::hasBoundary() const {
+    if constexpr (std::is_same<TBoundary, RuntimeBoundary>::value) {
+        return true;
+    } else {
+        const auto &boundary_conditions = geometry->boundary_conditions;
+        return boundary_conditions.coordinates == ORTHOGONAL &&
+               (boundary_conditions.direction.x() == PERIODIC) == TBoundary::x &&
+               (boundary_conditions.direction.y() == PERIODIC) == TBoundary::y &&
+               (boundary_conditions.direction.z() == PERIODIC) == TBoundary::z;
+    }
+}
+
 void to_json(json &, const Chameleon &);
 void from_json(const json &, Chameleon &);
 
@@ -308,6 +308,19 @@ TEST_CASE("[Faunus] Chameleon") {
         }
     };
 
+    //! function compares compile-time specialised and run-time vdist methods using n random points
+    auto compare_specialised_vdist = [&slump](auto boundary, Chameleon &chameleon, Cuboid &box, int n = 100) {
+        typedef decltype(boundary) TBoundary;
+        CHECK(chameleon.hasBoundary<TBoundary>());
+        Point a, b;
+        for (int i = 0; i < n; i++) {
+            box.randompos(a, slump);
+            box.randompos(b, slump);
+            CHECK((chameleon.vdist<TBoundary>(a, b) - chameleon.vdist(a, b)).norm() == Approx(0.0));
+            CHECK(chameleon.sqdist<TBoundary>(a, b) == Approx(chameleon.sqdist(a, b)));
+        }
+    };
+
     SUBCASE("cuboid") {
         double x = 2.0, y = 3.0, z = 4.0;
         Point box_size = std::cbrt(2.0) * Point(x, y, z);
@@ -316,6 +329,8 @@ TEST_CASE("[Faunus] Chameleon") {
         Chameleon chameleon(geo, CUBOID);
         compare_boundary(chameleon, geo, box);
         compare_vdist(chameleon, geo, box);
+        compare_specialised_vdist(CuboidBoundary(), chameleon, box);
+        CHECK(chameleon.hasBoundary<SlitBoundary>() == false);
     }
 
     SUBCASE("slit") {
@@ -326,6 +341,7 @@ TEST_CASE("[Faunus] Chameleon") {
         Chameleon chameleon(geo, SLIT);
         compare_boundary(chameleon, geo, box);
         compare_vdist(chameleon, geo, box);
+        compare_specialised_vdist(SlitBoundary(), chameleon, box);
     }
 
     SUBCASE("sphere") {
@@ -337,6 +353,7 @@ TEST_CASE("[Faunus] Chameleon") {
         Chameleon chameleon(geo, SPHERE);
         compare_boundary(chameleon, geo, box);
         compare_vdist(chameleon, geo, box);
+        compare_specialised_vdist(OpenBoundary(), chameleon, box);
     }
 
     SUBCASE("cylinder") {
@@ -370,6 +387,36 @@ TEST_CASE("[Faunus] Chameleon") {
         compare_vdist(chameleon, geo, box);
     }
 
+    SUBCASE("triclinic") {
+        double edge = 5.0;
+        Point box_size;
+        box_size.setConstant(std::cbrt(2.0) * edge * std::sqrt(5.0 / 2.0)); // enlarged circumradius
+        Cuboid box(box_size);
+        TruncatedOctahedron octahedron(edge);
+        Triclinic geo(TriclinicCell::truncatedOctahedron(octahedron.getLength().x()).getVectors());
+        CHECK(geo.getVolume() == Approx(octahedron.getVolume()));
+        CHECK(geo.getLength().x() == Approx(octahedron.getLength().x()));
+        Chameleon chameleon(geo, TRICLINIC);
+        compare_boundary(chameleon, octahedron, box);
+        compare_vdist(chameleon, octahedron, box);
+        CHECK(chameleon.isSkewed());
+
+        // skewed cell from json
+        Point a;
+        from_json(json({{"type", "triclinic"}, {"vectors", {{10, 0, 0}, {0, 9, 0}, {0, 0, 8}}}}), chameleon);
+        CHECK_FALSE(chameleon.isSkewed());
+        from_json(json({{"type", "triclinic"}, {"vectors", {{10, 0, 0}, {3, 9, 0}, {-4, 2, 8}}}}), chameleon);
+        CHECK(chameleon.getVolume() == Approx(720.0));
+        bool container_overlap = false;
+        for (int i = 0; i < 1000; i++) {
+            chameleon.randompos(a, slump);
+            container_overlap = container_overlap || chameleon.collision(a);
+        }
+        CHECK(container_overlap == false);
+        CHECK(chameleon.collision({0, 0, 0}) == false);
+        CHECK(chameleon.collision({5.01, 0, 0}) == true);
+    }
+
     SUBCASE("Cereal serialisation") {
         double x = 2.0, y = 3.0, z = 4.0;
         std::ostringstream os(std::stringstream::binary);
@@ -1,12 +1,22 @@
 #include "io.h"
+#include "auxiliary.h"
 #include "units.h"
 #include "random.h"
 #include "group.h"
+#include "space.h"
 #include <spdlog/spdlog.h>
 #include <zstr.hpp>
 #include <cereal/archives/binary.hpp>
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <cstring>
+#include <zlib.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace Faunus {
 
@@ -32,7 +42,8 @@ bool IO::writeFile(const std::string &file, const std::string &s, std::ios_base:
     std::ofstream f(file, mode);
     if (f) {
         f << s;
-        return true;
+        f.close();
+        return !f.fail();
     }
     return false;
 }
@@ -568,4 +579,240 @@ std::unique_ptr<std::istream> makeInputStream(const std::string &filename, std::
     return std::make_unique<zstr::ifstream>(filename, mode);
 }
 
+IndexedSpaceTrajectoryWriter::IndexedSpaceTrajectoryWriter(const std::string &filename)
+    : stream(filename, std::ios::binary) {
+    if (not stream) {
+        throw std::runtime_error("cannot open trajectory file " + filename);
+    }
+    stream.write(magic, sizeof(magic));
+}
+
+IndexedSpaceTrajectoryWriter::~IndexedSpaceTrajectoryWriter() {
+    if (stream) {
+        const std::uint64_t number_of_frames = offsets.size();
+        stream.write(reinterpret_cast<const char *>(offsets.data()), offsets.size() * sizeof(std::uint64_t));
+        stream.write(reinterpret_cast<const char *>(&number_of_frames), sizeof(number_of_frames));
+        stream.write(magic, sizeof(magic));
+    }
+}
+
+void IndexedSpaceTrajectoryWriter::save(const std::vector<Group<Particle>> &groups) {
+    std::ostringstream frame_stream(std::ios::binary);
+    { // each frame has its own archive so that frames can be read independently
+        cereal::BinaryOutputArchive archive(frame_stream);
+        for (const auto &group : groups) {
+            archive(group);
+        }
+    }
+    writeFrame(frame_stream.str());
+}
+
+void IndexedSpaceTrajectoryWriter::writeFrame(const std::string &frame) {
+    auto compressed_size = compressBound(frame.size());
+    compressed_buffer.resize(compressed_size);
+    if (compress2(reinterpret_cast<Bytef *>(compressed_buffer.data()), &compressed_size,
+                  reinterpret_cast<const Bytef *>(frame.data()), frame.size(), Z_DEFAULT_COMPRESSION) != Z_OK) {
+        throw std::runtime_error("trajectory frame compression failed");
+    }
+    const std::uint64_t sizes[2] = {compressed_size, frame.size()};
+    offsets.push_back(static_cast<std::uint64_t>(stream.tellp()));
+    stream.write(reinterpret_cast<const char *>(sizes), sizeof(sizes));
+    stream.write(compressed_buffer.data(), compressed_size);
+}
+
+void IndexedSpaceTrajectoryWriter::flush() { stream.flush(); }
+
+IndexedSpaceTrajectoryReader::IndexedSpaceTrajectoryReader(const std::string &filename) {
+    file_descriptor = ::open(filename.c_str(), O_RDONLY);
+    struct stat file_info;
+    if (file_descriptor < 0 || fstat(file_descriptor, &file_info) != 0) {
+        throw std::runtime_error("cannot open trajectory file " + filename);
+    }
+    length = file_info.st_size;
+    if (length < sizeof(IndexedSpaceTrajectoryWriter::magic) ||
+        (data = static_cast<const char *>(mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file_descriptor, 0))) ==
+            MAP_FAILED) {
+        data = nullptr;
+        ::close(file_descriptor);
+        throw std::runtime_error("cannot map trajectory file " + filename);
+    }
+    if (std::memcmp(data, IndexedSpaceTrajectoryWriter::magic, sizeof(IndexedSpaceTrajectoryWriter::magic)) != 0) {
+        munmap(const_cast<char *>(data), length);
+        ::close(file_descriptor);
+        throw std::runtime_error(filename + " is not an indexed trajectory");
+    }
+    readIndex();
+}
+
+IndexedSpaceTrajectoryReader::~IndexedSpaceTrajectoryReader() {
+    if (data != nullptr) {
+        munmap(const_cast<char *>(data), length);
+    }
+    if (file_descriptor >= 0) {
+        ::close(file_descriptor);
+    }
+}
+
+void IndexedSpaceTrajectoryReader::readIndex() {
+    constexpr auto magic_size = sizeof(IndexedSpaceTrajectoryWriter::magic);
+    offsets.clear();
+    if (length >= 2 * magic_size + sizeof(std::uint64_t) &&
+        std::memcmp(data + length - magic_size, IndexedSpaceTrajectoryWriter::magic, magic_size) == 0) {
+        std::uint64_t number_of_frames;
+        auto footer = data + length - magic_size - sizeof(number_of_frames);
+        std::memcpy(&number_of_frames, footer, sizeof(number_of_frames));
+        const auto index_end = std::size_t(footer - data);
+        if (number_of_frames <= (index_end - magic_size) / sizeof(std::uint64_t)) {
+            offsets.resize(number_of_frames);
+            std::memcpy(offsets.data(), footer - number_of_frames * sizeof(std::uint64_t),
+                        number_of_frames * sizeof(std::uint64_t));
+            const auto frames_end = index_end - number_of_frames * sizeof(std::uint64_t);
+            if (std::all_of(offsets.begin(), offsets.end(), [&](auto offset) {
+                    return offset >= magic_size && isValidFrame(offset, frames_end);
+                })) {
+                return;
+            }
+            offsets.clear();
+        }
+    }
+    faunus_logger->warn("trajectory index is missing or corrupt; scanning frames");
+    std::uint64_t sizes[2];
+    for (std::size_t offset = magic_size; offset + sizeof(sizes) <= length;) {
+        std::memcpy(sizes, data + offset, sizeof(sizes));
+        if (not isValidFrame(offset, length)) {
+            break; // truncated frame
+        }
+        offsets.push_back(offset);
+        offset += sizeof(sizes) + sizes[0];
+    }
+}
+
+/**
+ * As zlib cannot compress by more than a factor of about 1032, a larger uncompressed size
+ * stems from a corrupt header and is rejected before any memory is allocated for it.
+ *
+ * @param offset File position of the frame block
+ * @param end File position where frame data must end
+ * @return true if the block header and the compressed data fit before `end`
+ */
+bool IndexedSpaceTrajectoryReader::isValidFrame(std::size_t offset, std::size_t end) const {
+    constexpr std::uint64_t max_compression_ratio = 1032;
+    std::uint64_t sizes[2];
+    if (end > length || offset > end || end - offset < sizeof(sizes)) {
+        return false;
+    }
+    std::memcpy(sizes, data + offset, sizeof(sizes));
+    return sizes[0] <= end - offset - sizeof(sizes) && sizes[1] <= max_compression_ratio * (sizes[0] + 1);
+}
+
+std::size_t IndexedSpaceTrajectoryReader::size() const { return offsets.size(); }
+
+std::string IndexedSpaceTrajectoryReader::frame(std::size_t index) const {
+    std::uint64_t sizes[2]; // compressed and uncompressed size
+    const auto offset = offsets.at(index);
+    if (not isValidFrame(offset, length)) {
+        throw std::runtime_error("corrupt trajectory frame " + std::to_string(index));
+    }
+    std::memcpy(sizes, data + offset, sizeof(sizes));
+    std::string buffer(sizes[1], '\0');
+    uLongf uncompressed_size = sizes[1];
+    if (uncompress(reinterpret_cast<Bytef *>(buffer.data()), &uncompressed_size,
+                   reinterpret_cast<const Bytef *>(data + offset + sizeof(sizes)), sizes[0]) != Z_OK ||
+        uncompressed_size != sizes[1]) {
+        throw std::runtime_error("corrupt trajectory frame " + std::to_string(index));
+    }
+    return buffer;
+}
+
+void IndexedSpaceTrajectoryReader::load(std::size_t index, Space &spc) const {
+    std::istringstream frame_stream(frame(index), std::ios::binary);
+    cereal::BinaryInputArchive archive(frame_stream);
+    for (auto &group : spc.groups) {
+        archive(group);
+    }
+}
+
+SpaceTrajectoryReader::SpaceTrajectoryReader(const std::string &filename, const Space &spc)
+    : buffer(std::make_unique<Space>()) {
+    // a copy constructed Space would have groups pointing into `spc.p`
+    Change change;
+    change.all = true;
+    buffer->sync(spc, change);
+    stream = makeInputStream(filename, std::ios::binary);
+    if (stream == nullptr || not *stream) {
+        throw std::runtime_error("cannot open trajectory file " + filename);
+    }
+    format = std::make_unique<FormatSpaceTrajectory>(*stream);
+    prefetch();
+}
+
+SpaceTrajectoryReader::~SpaceTrajectoryReader() {
+    if (next_frame.valid()) {
+        next_frame.wait(); // the background thread refers to members
+    }
+}
+
+void SpaceTrajectoryReader::prefetch() {
+    next_frame = std::async(std::launch::async, [&] { return format->load(*buffer); });
+}
+
+/**
+ * Exceptions from the background thread, e.g. due to mismatching groups, are rethrown here.
+ *
+ * @param spc Destination space; particles and groups are overwritten
+ * @return true if a frame was read; false if the end of the trajectory has been reached
+ */
+bool SpaceTrajectoryReader::read(Space &spc) {
+    if (not next_frame.valid() || not next_frame.get()) {
+        return false;
+    }
+    Change change;
+    change.all = true;
+    auto geometry = spc.geo; // trajectories contain no geometry so keep the current
+    spc.sync(*buffer, change);
+    spc.geo = geometry;
+    prefetch();
+    return true;
+}
+
+ChromeTraceWriter::ChromeTraceWriter(const std::string &filename, std::size_t max_events)
+    : stream(filename), origin(ticks()), max_events(max_events) {
+    if (!stream) {
+        throw std::runtime_error("cannot open trace file " + filename);
+    }
+    stream << "{\"traceEvents\":[\n";
+}
+
+ChromeTraceWriter::~ChromeTraceWriter() {
+    stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    if (num_events >= max_events) {
+        faunus_logger->warn("trace limited to the first {} events", max_events);
+    }
+}
+
+bool ChromeTraceWriter::full() const { return num_events >= max_events; }
+
+/**
+ * @param name Event name, e.g. a move name
+ * @param category Event category; can be used to filter in the viewer
+ * @param start Time stamp from `ticks()` when the event started
+ * @param stop Time stamp from `ticks()` when the event ended
+ * @param arguments Additional information shown for the event
+ */
+void ChromeTraceWriter::event(const std::string &name, const std::string &category, uint64_t start, uint64_t stop,
+                              const json &arguments) {
+    if (num_events++ < max_events) {
+        const double microseconds_per_tick = 1.0e6 * secondsPerTick();
+        json j = {{"name", name},
+                  {"cat", category},
+                  {"ph", "X"},
+                  {"pid", 0},
+                  {"tid", 0},
+                  {"ts", (start - origin) * microseconds_per_tick},
+                  {"dur", (stop - start) * microseconds_per_tick},
+                  {"args", arguments}};
+        stream << (num_events > 1 ? ",\n" : "") << j;
+    }
+}
+
 } // namespace Faunus
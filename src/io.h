@@ -5,11 +5,13 @@
 #include "spdlog/spdlog.h"
 #include <cereal/archives/binary.hpp>
 #include <fstream>
+#include <future>
 #include <range/v3/distance.hpp>
 
 namespace Faunus {
 
 template <typename T = Particle> class Group;
+class Space;
 
 #ifndef __cplusplus
 #define __cplusplus
@@ -320,13 +322,15 @@ std::unique_ptr<std::ostream> makeOutputStream(const std::string &, std::ios_bas
 std::unique_ptr<std::istream> makeInputStream(const std::string &, std::ios_base::openmode);
 
 /**
- * @brief Placeholder for Space Trajectory
+ * @brief Space Trajectory
  *
- * The idea is that the format handles both input and
- * output streams that may of may not be compressed.
+ * The format handles both input and output streams that may of may not be compressed.
+ * A frame consists of all groups, including particles, as written by `Analysis::SpaceTrajectory`.
+ * Geometry is not stored.
  */
 class FormatSpaceTrajectory {
   private:
+    std::istream *input_stream = nullptr;
     std::unique_ptr<cereal::BinaryOutputArchive> output_archive;
     std::unique_ptr<cereal::BinaryInputArchive> input_archive;
 
@@ -335,16 +339,138 @@ class FormatSpaceTrajectory {
         if (ostream)
             output_archive = std::make_unique<cereal::BinaryOutputArchive>(ostream);
     }
-    FormatSpaceTrajectory(std::istream &istream) {
+    FormatSpaceTrajectory(std::istream &istream) : input_stream(&istream) {
         if (istream)
             input_archive = std::make_unique<cereal::BinaryInputArchive>(istream);
     }
-    template <class Tspace> void load(Tspace &) {
-      assert(input_archive != nullptr);
-    } //!< Load single frame from stream
-    template <class Tspace> void save(const Tspace &) {
-      assert(output_archive != nullptr);
-    } //!< Save single frame from stream
+
+    /**
+     * @brief Load single frame from stream
+     * @return false if the end of the stream has been reached; true otherwise
+     * @throw if the groups in space do not match those in the stream
+     */
+    template <class Tspace> bool load(Tspace &spc) {
+        assert(input_archive != nullptr);
+        if (input_stream->peek() == std::char_traits<char>::eof()) {
+            return false;
+        }
+        for (auto &group : spc.groups) {
+            (*input_archive)(group);
+        }
+        return true;
+    }
+
+    template <class Tspace> void save(const Tspace &spc) {
+        assert(output_archive != nullptr);
+        for (const auto &group : spc.groups) {
+            (*output_archive)(group);
+        }
+    } //!< Save single frame to stream
+};
+
+/**
+ * @brief Frame-indexed Space trajectory writer (.itraj)
+ *
+ * Unlike the sequential `.traj`/`.ztraj` format, each frame is an independently
+ * zlib compressed block so that frames can be accessed in random order. File layout:
+ *
+ * - header: magic string
+ * - frame blocks: compressed size, uncompressed size, compressed data
+ * - footer: offsets of all frame blocks, number of frames, magic string
+ *
+ * All integers are 64-bit in native byte order. The footer is written upon destruction
+ * and if missing, e.g. due to a crash, the reader rebuilds the index by scanning the blocks.
+ * The uncompressed frame data is identical to a frame of `FormatSpaceTrajectory`.
+ */
+class IndexedSpaceTrajectoryWriter {
+  private:
+    std::ofstream stream;
+    std::vector<std::uint64_t> offsets; //!< file position of each frame block
+    std::string compressed_buffer;      //!< reused between frames
+    void writeFrame(const std::string &); //!< Compress and write serialised frame
+
+  public:
+    static constexpr char magic[] = "FAUNUSITRAJ1";
+    explicit IndexedSpaceTrajectoryWriter(const std::string &filename);
+    ~IndexedSpaceTrajectoryWriter(); //!< Writes footer with frame index
+    void save(const std::vector<Group<Particle>> &groups); //!< Write all groups as a single frame
+    void flush();
+};
+
+/**
+ * @brief Memory mapped, random access reader of frame-indexed Space trajectories (.itraj)
+ *
+ * Frames are decompressed on demand directly from the mapped file and all frame access
+ * is `const`, so that different frames can be loaded concurrently from several threads.
+ */
+class IndexedSpaceTrajectoryReader {
+  private:
+    int file_descriptor = -1;
+    const char *data = nullptr;         //!< start of the memory mapped file
+    std::size_t length = 0;             //!< length of the memory mapped file
+    std::vector<std::uint64_t> offsets; //!< file position of each frame block
+    void readIndex();                   //!< Read index from footer or, if missing, by scanning
+    bool isValidFrame(std::size_t offset, std::size_t end) const; //!< Is frame block sane and before end?
+
+  public:
+    explicit IndexedSpaceTrajectoryReader(const std::string &filename);
+    ~IndexedSpaceTrajectoryReader();
+    IndexedSpaceTrajectoryReader(const IndexedSpaceTrajectoryReader &) = delete;
+    IndexedSpaceTrajectoryReader &operator=(const IndexedSpaceTrajectoryReader &) = delete;
+    std::size_t size() const;                       //!< Number of frames
+    std::string frame(std::size_t index) const;     //!< Uncompressed data of frame
+    void load(std::size_t index, Space &spc) const; //!< Load frame into Space (geometry is untouched)
+};
+
+/**
+ * @brief Sequential reader of Space trajectories with read-ahead
+ *
+ * The next frame is read and decompressed on a background thread into a private
+ * copy of Space, while the caller processes the current frame. Calling `read()`
+ * waits for the pending frame, copies it into the given Space and starts reading
+ * the next.
+ *
+ * @note The geometry is not part of the trajectory and is left untouched
+ */
+class SpaceTrajectoryReader {
+  private:
+    std::unique_ptr<std::istream> stream;
+    std::unique_ptr<FormatSpaceTrajectory> format;
+    std::unique_ptr<Space> buffer; //!< the next frame is loaded into this
+    std::future<bool> next_frame;  //!< true if the pending frame was successfully loaded
+    void prefetch();               //!< Start loading next frame in background
+
+  public:
+    /**
+     * @param filename Trajectory file (.traj/.ztraj); compression is auto-detected
+     * @param spc Space used as template for the frames (groups and capacities must match)
+     */
+    SpaceTrajectoryReader(const std::string &filename, const Space &spc);
+    ~SpaceTrajectoryReader();
+    bool read(Space &spc); //!< Copy next frame into Space; false if no more frames
+};
+
+/**
+ * @brief Writes timed events in the Chrome trace event format
+ *
+ * The file can be inspected with `chrome://tracing` or https://ui.perfetto.dev.
+ * Event times are given as time stamps from `ticks()` and are stored in microseconds
+ * relative to construction. To limit the file size, events beyond `max_events` are dropped;
+ * callers can check `full()` to avoid preparing event arguments in vain.
+ */
+class ChromeTraceWriter {
+  private:
+    std::ofstream stream;
+    uint64_t origin;          //!< time stamp at construction
+    std::size_t max_events;   //!< maximum number of events to write
+    std::size_t num_events = 0;
+
+  public:
+    ChromeTraceWriter(const std::string &filename, std::size_t max_events = 100000);
+    ~ChromeTraceWriter(); //!< Closes the event array
+    bool full() const;    //!< True once `max_events` are written; further events are dropped
+    void event(const std::string &name, const std::string &category, uint64_t start, uint64_t stop,
+               const json &arguments = json::object()); //!< Write complete event spanning [start:stop]
 };
 
 } // namespace Faunus
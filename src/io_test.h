@@ -50,5 +50,121 @@ TEST_CASE("[Faunus] FormatPQR") {
     }
 }
 
+/** Sets particle positions that are unique for the given frame parameter */
+static void setFramePositions(Space &spc, double x) {
+    for (size_t i = 0; i < spc.p.size(); i++) {
+        spc.p[i].pos = {x, x + i, -x};
+    }
+}
+
+/** Checks particle positions against setFramePositions() */
+static void checkFramePositions(const Space &spc, double x) {
+    for (size_t i = 0; i < spc.p.size(); i++) {
+        CHECK(spc.p[i].pos.x() == Approx(x));
+        CHECK(spc.p[i].pos.y() == Approx(x + i));
+        CHECK(spc.p[i].pos.z() == Approx(-x));
+    }
+}
+
+TEST_CASE("[Faunus] SpaceTrajectoryReader") {
+    Space spc;
+    SpaceFactory::makeNaCl(spc, 2, R"( {"type": "cuboid", "length": 20} )"_json);
+    const std::string filename = "space_trajectory_test.traj";
+    {
+        std::ofstream stream(filename, std::ios::binary);
+        FormatSpaceTrajectory format(stream);
+        setFramePositions(spc, 1.0);
+        format.save(spc);
+        setFramePositions(spc, 2.0);
+        format.save(spc);
+    }
+    setFramePositions(spc, 0.0);
+    {
+        // the reader must not write into `spc` while the current frame is processed
+        SpaceTrajectoryReader reader(filename, spc);
+        CHECK(reader.read(spc));
+        checkFramePositions(spc, 1.0);
+        setFramePositions(spc, 0.0);
+        CHECK(reader.read(spc));
+        checkFramePositions(spc, 2.0);
+        CHECK_FALSE(reader.read(spc));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("[Faunus] IndexedSpaceTrajectory") {
+    Space spc;
+    SpaceFactory::makeNaCl(spc, 2, R"( {"type": "cuboid", "length": 20} )"_json);
+    const std::string filename = "space_trajectory_test.itraj";
+    {
+        IndexedSpaceTrajectoryWriter writer(filename);
+        setFramePositions(spc, 1.0);
+        writer.save(spc.groups);
+        setFramePositions(spc, 2.0);
+        writer.save(spc.groups);
+    }
+    setFramePositions(spc, 0.0);
+
+    SUBCASE("Random access") {
+        IndexedSpaceTrajectoryReader reader(filename);
+        REQUIRE(reader.size() == 2);
+        reader.load(1, spc);
+        checkFramePositions(spc, 2.0);
+        reader.load(0, spc);
+        checkFramePositions(spc, 1.0);
+        CHECK_THROWS(reader.load(2, spc));
+    }
+
+    SUBCASE("Corrupt frame size") {
+        { // claim a huge uncompressed size of the second frame
+            std::fstream stream(filename, std::ios::in | std::ios::out | std::ios::binary);
+            const auto first_frame = static_cast<std::streamoff>(sizeof(IndexedSpaceTrajectoryWriter::magic));
+            std::uint64_t sizes[2];
+            stream.seekg(first_frame);
+            stream.read(reinterpret_cast<char *>(sizes), sizeof(sizes));
+            const auto second_frame = first_frame + static_cast<std::streamoff>(sizeof(sizes) + sizes[0]);
+            sizes[1] = std::numeric_limits<std::uint64_t>::max() / 2;
+            stream.seekp(second_frame + static_cast<std::streamoff>(sizeof(std::uint64_t)));
+            stream.write(reinterpret_cast<const char *>(&sizes[1]), sizeof(sizes[1]));
+        }
+        IndexedSpaceTrajectoryReader reader(filename); // the index is rebuilt up to the corrupt frame
+        REQUIRE(reader.size() == 1);
+        reader.load(0, spc);
+        checkFramePositions(spc, 1.0);
+    }
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("[Faunus] ChromeTraceWriter") {
+    const std::string filename = "trace_test.json";
+    {
+        ChromeTraceWriter trace(filename, 2);
+        const auto start = ticks();
+        trace.event("translate", "atom", start, start + 1000, {{"du", -1.5}});
+        CHECK_FALSE(trace.full());
+        trace.event("rotate", "group", start + 1000, start + 3000);
+        CHECK(trace.full());
+        trace.event("dropped", "atom", start + 3000, start + 4000);
+    } // event array is closed upon destruction
+    std::ifstream stream(filename);
+    REQUIRE(stream);
+    const auto j = json::parse(stream);
+    stream.close();
+    std::remove(filename.c_str());
+
+    CHECK(j.at("displayTimeUnit") == "ms");
+    const auto &events = j.at("traceEvents");
+    REQUIRE(events.size() == 2);
+    const auto &event = events.at(0);
+    CHECK(event.at("name") == "translate");
+    CHECK(event.at("cat") == "atom");
+    CHECK(event.at("ph") == "X");
+    CHECK(event.at("args").at("du") == Approx(-1.5));
+    CHECK(event.at("ts").get<double>() >= 0.0);
+    CHECK(event.at("dur").get<double>() == Approx(1000 * 1.0e6 * secondsPerTick()));
+    CHECK(events.at(1).at("ts").get<double>() == Approx(event.at("ts").get<double>() + event.at("dur").get<double>()));
+    CHECK(events.at(1).at("args").empty());
+}
+
 #endif
 } // namespace Faunus
@@ -29,7 +29,8 @@ int &MoleculeData::id() { return _id; }
 
 const int &MoleculeData::id() const { return _id; }
 
-ParticleVector MoleculeData::getRandomConformation(Geometry::GeometryBase &geo, ParticleVector otherparticles) {
+ParticleVector MoleculeData::getRandomConformation(Geometry::GeometryBase &geo,
+                                                   const ParticleVector &otherparticles) {
     assert(inserter != nullptr);
     return (*inserter)(geo, otherparticles, *this);
 }
@@ -511,28 +512,210 @@ void to_json(json &j, const ExclusionsVicinity &exclusions) {
 void from_json(const json &j, MoleculeInserter &inserter) { inserter.from_json(j); }
 void to_json(json &j, const MoleculeInserter &inserter) { inserter.to_json(j); }
 
-ParticleVector RandomInserter::operator()(Geometry::GeometryBase &geo, const ParticleVector &, MoleculeData &mol) {
+void OverlapGrid::reset(const Point &new_box_length, double new_cell_size) {
+    cells.clear();
+    num_sites = 0;
+    box_length = new_box_length;
+    cell_size = new_cell_size;
+    for (int k = 0; k < 3; k++) {
+        num_cells[k] = (cell_size > 0.0) ? std::max(1, static_cast<int>(box_length[k] / cell_size)) : 1;
+    }
+}
+
+Eigen::Vector3i OverlapGrid::cellCoordinates(const Point &pos) const {
+    Eigen::Vector3i coordinates;
+    for (int k = 0; k < 3; k++) {
+        coordinates[k] = static_cast<int>(std::floor((pos[k] / box_length[k] + 0.5) * num_cells[k]));
+    }
+    return coordinates;
+}
+
+size_t OverlapGrid::cellIndex(Eigen::Vector3i coordinates) const {
+    for (int k = 0; k < 3; k++) { // wrap around the box
+        coordinates[k] = (coordinates[k] % num_cells[k] + num_cells[k]) % num_cells[k];
+    }
+    return (static_cast<size_t>(coordinates.z()) * num_cells.y() + coordinates.y()) * num_cells.x() + coordinates.x();
+}
+
+void OverlapGrid::add(const Particle &particle) {
+    cells[cellIndex(cellCoordinates(particle.pos))].push_back({particle.pos, particle.id});
+    num_sites++;
+}
+
+/**
+ * Particles overlap if closer than the mean of their `sigma` values.
+ */
+bool OverlapGrid::overlap(const Particle &particle, const Geometry::GeometryBase &geo) const {
+    const auto center = cellCoordinates(particle.pos);
+    const double sigma = atoms[particle.id].sigma;
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dz = -1; dz <= 1; dz++) {
+                if (auto cell = cells.find(cellIndex(center + Eigen::Vector3i(dx, dy, dz))); cell != cells.end()) {
+                    for (const auto &site : cell->second) {
+                        const double contact_distance = 0.5 * (sigma + atoms[site.id].sigma);
+                        if (geo.vdist(particle.pos, site.pos).squaredNorm() < contact_distance * contact_distance) {
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+size_t OverlapGrid::size() const { return num_sites; }
+
+const Point &OverlapGrid::getBoxLength() const { return box_length; }
+
+double OverlapGrid::getCellSize() const { return cell_size; }
+
+/**
+ * The grid is extended by the particles appended to `others` since the previous call, as when molecules
+ * are inserted one by one at start-up. It is rebuilt if `others` is reallocated or shrinks, or if the
+ * geometry changes size. Particles that have moved between calls are not detected.
+ */
+void RandomInserter::updateOverlapGrid(const Geometry::GeometryBase &geo, const ParticleVector &others) {
+    if (others.data() != grid_data || others.size() < overlap_grid.size() ||
+        geo.getLength() != overlap_grid.getBoxLength()) {
+        double max_sigma = 0.0;
+        for (const auto &atom : atoms) {
+            max_sigma = std::max(max_sigma, atom.sigma);
+        }
+        overlap_grid.reset(geo.getLength(), max_sigma);
+        grid_data = others.data();
+    }
+    std::for_each(others.begin() + overlap_grid.size(), others.end(),
+                  [&](const auto &particle) { overlap_grid.add(particle); });
+}
+
+void RandomInserter::reset() {
+    overlap_grid = OverlapGrid();
+    grid_data = nullptr;
+}
+
+/**
+ * Atoms of atomic molecules are also checked against each other, while
+ * atoms in the same molecular group are not.
+ */
+bool RandomInserter::overlapsOthers(const Geometry::GeometryBase &geo, const ParticleVector &particles,
+                                    const MoleculeData &mol) const {
+    for (auto it = particles.begin(); it != particles.end(); ++it) {
+        if (overlap_grid.overlap(*it, geo)) {
+            return true;
+        }
+        if (mol.atomic) {
+            for (auto other = particles.begin(); other != it; ++other) {
+                const double contact_distance = 0.5 * (atoms[it->id].sigma + atoms[other->id].sigma);
+                if (geo.vdist(it->pos, other->pos).squaredNorm() < contact_distance * contact_distance) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Fallback if random insertion fails: a simple cubic lattice with a spacing equal to the
+ * largest `sigma` is scanned and the molecule is placed, without rotation, at the first free site.
+ * For atomic molecules, each atom is placed on a separate site.
+ *
+ * @param particles Conformation to place; positions are overwritten
+ * @return True if a free site was found
+ */
+bool RandomInserter::placeOnLattice(const Geometry::GeometryBase &geo, ParticleVector &particles,
+                                    const MoleculeData &mol) const {
+    const double spacing = overlap_grid.getCellSize();
+    if (spacing <= 0.0) {
+        return false;
+    }
+    const Point box = geo.getLength();
+    const Eigen::Vector3i num_sites = (box / spacing).array().floor().cast<int>().max(1).matrix();
+    const size_t total_sites = static_cast<size_t>(num_sites.x()) * num_sites.y() * num_sites.z();
+    auto site_position = [&](size_t n) {
+        const size_t num_xy = static_cast<size_t>(num_sites.x()) * num_sites.y();
+        const Eigen::Vector3i ijk(static_cast<int>(n % num_sites.x()), static_cast<int>((n % num_xy) / num_sites.x()),
+                                  static_cast<int>(n / num_xy));
+        Point site = -0.5 * box + spacing * (ijk.cast<double>() + Point::Constant(0.5));
+        site = site.cwiseProduct(dir) + offset;
+        geo.boundary(site);
+        return site;
+    };
+    auto is_free = [&](const Particle &particle) {
+        return !geo.collision(particle.pos) && !overlap_grid.overlap(particle, geo);
+    };
+    if (mol.atomic) {
+        size_t n = 0;
+        for (auto &particle : particles) {
+            do {
+                if (n == total_sites) {
+                    return false;
+                }
+                particle.pos = site_position(n++);
+            } while (!is_free(particle));
+        }
+        return true;
+    }
+    Geometry::cm2origo(particles.begin(), particles.end());
+    ParticleVector trial = particles;
+    for (size_t n = 0; n < total_sites; n++) {
+        const Point site = site_position(n);
+        for (size_t i = 0; i < particles.size(); i++) {
+            trial[i].pos = particles[i].pos + site;
+            geo.boundary(trial[i].pos);
+        }
+        if (std::all_of(trial.begin(), trial.end(), is_free)) {
+            particles = trial;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * If `avoid_overlap` is set, positions overlapping with `others` are rejected as well, see `OverlapGrid`.
+ * Should random insertion fail, the molecule is placed on a lattice.
+ */
+ParticleVector RandomInserter::operator()(Geometry::GeometryBase &geo, const ParticleVector &others,
+                                          MoleculeData &mol) {
     int cnt = 0;
     QuaternionRotate rot;
     bool containerOverlap; // true if container overlap detected
+    auto &rng = *random_engine;
 
     if (std::fabs(geo.getVolume()) < 1e-20)
         throw std::runtime_error("geometry has zero volume");
 
-    ParticleVector v = mol.conformations.sample(random.engine); // get random, weighted conformation
+    ParticleVector v = mol.conformations.sample(rng.engine);    // get random, weighted conformation
     conformation_ndx = mol.conformations.getLastIndex();        // latest index
 
+    const bool check_overlap = avoid_overlap && (mol.atomic || !keep_positions);
+    const ParticleVector conformation = check_overlap ? v : ParticleVector(); // for lattice fallback
+    if (check_overlap) {
+        updateOverlapGrid(geo, others);
+    }
+
     do {
-        if (cnt++ > max_trials)
+        if (cnt++ > max_trials) {
+            if (check_overlap) {
+                v = conformation;
+                if (placeOnLattice(geo, v, mol)) {
+                    faunus_logger->debug("{}: random insertion failed; placed on lattice", mol.name);
+                    return v;
+                }
+            }
             throw std::runtime_error("Max. # of overlap checks reached upon insertion.");
+        }
 
         if (mol.atomic) {       // insert atomic species
             for (auto &i : v) { // for each atom type id
                 if (rotate) {
-                    rot.set(2 * pc::pi * random(), ranunit(random));
+                    rot.set(2 * pc::pi * rng(), ranunit(rng));
                     i.rotate(rot.first, rot.second);
                 }
-                geo.randompos(i.pos, random);
+                geo.randompos(i.pos, rng);
                 i.pos = i.pos.cwiseProduct(dir) + offset;
                 geo.boundary(i.pos);
             }
@@ -543,10 +726,10 @@ ParticleVector RandomInserter::operator()(Geometry::GeometryBase &geo, const Par
                         throw std::runtime_error("Error: Inserted molecule does not fit in container");
             } else {
                 Point cm;                                        // new mass center position
-                geo.randompos(cm, random);                       // random point in container
+                geo.randompos(cm, rng);                          // random point in container
                 cm = cm.cwiseProduct(dir);                       // apply user defined directions (default: 1,1,1)
                 Geometry::cm2origo(v.begin(), v.end());          // translate to origin
-                rot.set(random() * 2 * pc::pi, ranunit(random)); // random rot around random vector
+                rot.set(rng() * 2 * pc::pi, ranunit(rng));       // random rot around random vector
                 if (rotate) {
                     Geometry::rotate(v.begin(), v.end(), rot.first);
                     assert(Geometry::massCenter(v.begin(), v.end()).norm() < 1e-6); // cm shouldn't move
@@ -571,7 +754,7 @@ ParticleVector RandomInserter::operator()(Geometry::GeometryBase &geo, const Par
                 }
             }
         }
-    } while (containerOverlap);
+    } while (containerOverlap || (check_overlap && overlapsOthers(geo, v, mol)));
     return v;
 }
 
@@ -580,6 +763,7 @@ void RandomInserter::from_json(const json &j) {
     offset = j.value("insoffset", offset);
     rotate = j.value("rotate", rotate);
     keep_positions = j.value("keeppos", keep_positions);
+    avoid_overlap = j.value("avoid_overlap", avoid_overlap);
 }
 
 void RandomInserter::to_json(json &j) const {
@@ -587,6 +771,9 @@ void RandomInserter::to_json(json &j) const {
     j["insoffset"] = offset;
     j["rotate"] = rotate;
     j["keeppos"] = keep_positions;
+    if (avoid_overlap) {
+        j["avoid_overlap"] = avoid_overlap;
+    }
 }
 
 bool Conformation::empty() const {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <set>
+#include <unordered_map>
 #include "core.h"
 #include "auxiliary.h"
 #include "particle.h"
@@ -34,24 +35,64 @@ struct MoleculeInserter {
     virtual ParticleVector operator()(Geometry::GeometryBase &geo, const ParticleVector &, MoleculeData &mol) = 0;
     virtual void from_json(const json&) {};
     virtual void to_json(json&) const {};
+    virtual void reset() {} //!< Discard data kept between consecutive insertions
     virtual ~MoleculeInserter() = default;
 };
 
 void from_json(const json &j, MoleculeInserter &inserter);
 void to_json(json &j, const MoleculeInserter &inserter);
 
+/**
+ * @brief Spatial hash of particle positions for fast overlap checks
+ *
+ * Particles are binned into cells no smaller than the largest contact distance (`sigma`)
+ * so that overlapping particles are always found in the 27 surrounding cells. Cells wrap
+ * around the box containing the geometry, hence periodic images are also found.
+ */
+class OverlapGrid {
+    struct Site {
+        Point pos;
+        int id;
+    };
+    std::unordered_map<size_t, std::vector<Site>> cells; //!< Sites in each occupied cell
+    Eigen::Vector3i num_cells = {1, 1, 1};            //!< Number of cells in each direction
+    Point box_length = {0, 0, 0};                     //!< Sides of the box containing the geometry
+    double cell_size = 0.0;                           //!< Minimum cell side
+    size_t num_sites = 0;
+    Eigen::Vector3i cellCoordinates(const Point &) const;
+    size_t cellIndex(Eigen::Vector3i) const;
+
+  public:
+    void reset(const Point &box_length, double cell_size); //!< Clear grid and set dimensions
+    void add(const Particle &);                              //!< Add particle to grid
+    bool overlap(const Particle &, const Geometry::GeometryBase &) const; //!< True if particle overlaps any site
+    size_t size() const;                                     //!< Number of particles in grid
+    const Point &getBoxLength() const;
+    double getCellSize() const;
+};
+
 struct RandomInserter : public MoleculeInserter {
     Point dir = {1, 1, 1};     //!< Scalars for random mass center position. Default (1,1,1)
     Point offset = {0, 0, 0};  //!< Added to random position. Default (0,0,0)
     bool rotate = true;           //!< Set to true to randomly rotate molecule when inserted. Default: true
     bool keep_positions = false;  //!< Set to true to keep original positions (default: false)
     bool allow_overlap = false;   //!< Set to true to skip container overlap check
+    bool avoid_overlap = false;   //!< Set to true to reject positions overlapping with other particles
     int max_trials = 20'000;      //!< Maximum number of container overlap checks
     int conformation_ndx = -1;    //!< Index of last used conformation
+    Random *random_engine = &Faunus::random; //!< Random number generator; replace for thread-private insertion
 
     ParticleVector operator()(Geometry::GeometryBase &geo, const ParticleVector &, MoleculeData &mol) override;
     void from_json(const json &j) override;
     void to_json(json &j) const override;
+    void reset() override; //!< Release the overlap grid
+
+  private:
+    OverlapGrid overlap_grid;                  //!< Other particles seen so far (`avoid_overlap` only)
+    const Particle *grid_data = nullptr;       //!< Start of particle vector indexed in `overlap_grid`
+    void updateOverlapGrid(const Geometry::GeometryBase &, const ParticleVector &);
+    bool overlapsOthers(const Geometry::GeometryBase &, const ParticleVector &, const MoleculeData &) const;
+    bool placeOnLattice(const Geometry::GeometryBase &, ParticleVector &, const MoleculeData &) const;
 };
 
 /**
@@ -144,6 +185,7 @@ class ExclusionsVicinity {
     //! @param i, j indices of atoms within molecule with excluded nonbonded interaction
     bool isExcluded(int i, int j) const;
     bool empty() const; //!< true if no excluded interactions at all
+    int maxDistance() const; //!< maximal index difference between excluded particles; pairs further apart interact
     // friend void from_json(const json &j, ExclusionsVicinity &exclusions); // not implemented
     friend void to_json(json &j, const ExclusionsVicinity &exclusions);
 };
@@ -158,6 +200,8 @@ inline bool ExclusionsVicinity::isExcluded(int i, int j) const {
 
 inline bool ExclusionsVicinity::empty() const { return max_bond_distance == 0; }
 
+inline int ExclusionsVicinity::maxDistance() const { return max_bond_distance; }
+
 inline int ExclusionsVicinity::toIndex(int i, int j) const { return i * max_bond_distance + (j - i - 1); }
 
 inline std::pair<int, int> ExclusionsVicinity::fromIndex(int n) const {
@@ -204,6 +248,7 @@ class MoleculeData {
     bool isImplicit() const { return implicit; } //!< Is molecule implicit and explicitly absent from simulation cell?
 
     bool isPairExcluded(int i, int j) const;
+    int maxExcludedDistance() const; //!< No pair of atoms further apart in the sequence is excluded
 
     /** @brief Specify function to be used when inserting into space.
      *
@@ -221,7 +266,7 @@ class MoleculeData {
      * be changed by specifying another inserter using `setInserter()`.
      */
     ParticleVector getRandomConformation(Geometry::GeometryBase &geo,
-                                         ParticleVector otherparticles = ParticleVector());
+                                         const ParticleVector &otherparticles = ParticleVector());
 
     void loadConformation(const std::string &file, bool keep_positions, bool keep_charges);
 
@@ -232,6 +277,8 @@ class MoleculeData {
 
 inline bool MoleculeData::isPairExcluded(int i, int j) const { return exclusions.isExcluded(i, j); }
 
+inline int MoleculeData::maxExcludedDistance() const { return exclusions.maxDistance(); }
+
 void to_json(json &j, const MoleculeData &a);
 
 void from_json(const json &j, MoleculeData &a);
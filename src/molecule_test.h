@@ -1,4 +1,5 @@
 #include "molecule.h"
+#include "geometry.h"
 
 namespace Faunus {
 
@@ -126,6 +127,7 @@ TEST_CASE("[Faunus] ExclusionsVicinity") {
     CHECK_FALSE(exclusions.isExcluded(2,3));
     CHECK_FALSE(exclusions.isExcluded(4,5));
     CHECK_FALSE(exclusions.isExcluded(8,9));
+    CHECK(exclusions.maxDistance() == 2);
 }
 
 TEST_CASE("[Faunus] MoleculeData") {
@@ -192,6 +194,58 @@ TEST_CASE("[Faunus] MoleculeBuilder") {
     CHECK(molecule.isPairExcluded(7, 1));
 }
 
+TEST_CASE("[Faunus] OverlapGrid") {
+    atoms = R"([{"A": {"sigma": 2.0}}, {"B": {"sigma": 4.0}}])"_json.get<decltype(atoms)>();
+    Geometry::Cuboid geo(10.0);
+    OverlapGrid grid;
+    grid.reset(geo.getLength(), 4.0);
+    Particle a, b;
+    a.id = 0;
+    a.pos = {4.5, 0.0, 0.0};
+    grid.add(a);
+    CHECK(grid.size() == 1);
+    b.id = 0;
+    b.pos = {-4.5, 0.0, 0.0}; // periodic image is 1 Å away
+    CHECK(grid.overlap(b, geo) == true);
+    b.pos = {0.0, 0.0, 0.0};
+    CHECK(grid.overlap(b, geo) == false);
+    b.pos = {2.4, 0.0, 0.0};
+    CHECK(grid.overlap(b, geo) == false);
+    b.id = 1; // contact distance is now 3 Å
+    CHECK(grid.overlap(b, geo) == true);
+    grid.reset(geo.getLength(), 4.0);
+    CHECK(grid.size() == 0);
+    CHECK(grid.overlap(b, geo) == false);
+}
+
+TEST_CASE("[Faunus] RandomInserter - lattice fallback") {
+    atoms = R"([{"A": {"sigma": 2.0}}])"_json.get<decltype(atoms)>();
+    molecules = R"([{"salt": {"atomic": true, "atoms": ["A"]}}])"_json.get<decltype(molecules)>();
+    Geometry::Cuboid geo(10.0);
+    RandomInserter inserter;
+    inserter.avoid_overlap = true;
+    inserter.max_trials = -1; // skip random insertion
+
+    // occupy all sites of the 5x5x5 lattice with spacing sigma, except the central one
+    ParticleVector others;
+    for (int n = 0; n < 125; n++) {
+        if (n != 62) {
+            Particle particle;
+            particle.id = 0;
+            particle.pos = 2.0 * Point(n % 5, (n / 5) % 5, n / 25) - Point(4.0, 4.0, 4.0);
+            others.push_back(particle);
+        }
+    }
+    const auto inserted = inserter(geo, others, molecules.front());
+    REQUIRE(inserted.size() == 1);
+    CHECK(inserted.front().pos.isZero(1e-9));
+
+    // no free site is left
+    others.push_back(inserted.front());
+    inserter.reset();
+    CHECK_THROWS_AS(inserter(geo, others, molecules.front()), std::runtime_error);
+}
+
 TEST_CASE("[Faunus] Conformation") {
     ParticleVector p(1);
     Conformation c;
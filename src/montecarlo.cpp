@@ -2,7 +2,12 @@
 #include "speciation.h"
 #include "energy.h"
 #include "move.h"
+#include "io.h"
 #include "spdlog/spdlog.h"
+#include <cereal/archives/binary.hpp>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace Faunus {
 
@@ -10,7 +15,14 @@ namespace Faunus {
  * @param du Energy change in units of kT
  * @return True if accepted, false of rejected
  */
-bool MetropolisMonteCarlo::metropolis(double du) const {
+bool MetropolisMonteCarlo::metropolis(double du) const { return metropolis(du, Move::Movebase::slump); }
+
+/**
+ * @param du Energy change in units of kT
+ * @param random Random number generator
+ * @return True if accepted, false of rejected
+ */
+bool MetropolisMonteCarlo::metropolis(double du, Random &random) {
     if (std::isnan(du)) {
         throw std::runtime_error("Metropolis error: energy cannot be NaN");
     }
@@ -20,10 +32,27 @@ bool MetropolisMonteCarlo::metropolis(double du) const {
         if (-du > pc::max_exp_argument) {
             mcloop_logger->warn("large negative metropolis energy");
         }
-        return Move::Movebase::slump() <= std::exp(-du);
+        return random() <= std::exp(-du);
     }
 }
 
+/**
+ * @param energy Energy before move (kT)
+ * @param trial_energy Energy after move (kT)
+ * @return Energy change (kT) where NaN is mapped to always accept or reject
+ */
+double MetropolisMonteCarlo::energyChange(double energy, double trial_energy) {
+    double du = trial_energy - energy;                         // potential energy change (kT)
+    if (std::isnan(energy) and not std::isnan(trial_energy)) { // if NaN --> finite energy change
+        du = pc::neg_infty;                                    // ...always accept
+    } else if (std::isnan(trial_energy)) {                     // if moving to NaN, e.g. division by zero,
+        du = pc::infty;                                        // ...always reject
+    } else if (std::isnan(du)) {                               // if difference is NaN, e.g. infinity - infinity,
+        du = 0.0;                                              // ...always accept
+    }
+    return du;
+}
+
 /**
  * This performas the following tasks:
  * - syncs the two states
@@ -46,6 +75,9 @@ void MetropolisMonteCarlo::init() {
     trial_state->sync(*state, change); // copy all information into trial state
     trial_state->pot->init();
     double trial_energy = trial_state->pot->energy(change);
+    if (checkerboard) {
+        checkerboard->record(change); // replicas copy everything before the next sweep
+    }
 
     // check that the energies in the two states are *identical*
     if (std::isfinite(energy) and std::isfinite(trial_energy)) {
@@ -90,6 +122,572 @@ double MetropolisMonteCarlo::relativeEnergyDrift() {
     return std::numeric_limits<double>::quiet_NaN();
 }
 
+/**
+ * @brief Parallel sweeps of atomic and molecular moves using a checkerboard domain decomposition
+ *
+ * The box is divided into domains that are at least as wide as the interaction range, colored by the
+ * parity of their cell coordinates so that domains of the same color are separated by at least one domain.
+ * Atoms and molecular mass centers are confined to their domain, and thus cannot interact with atoms or
+ * molecules moved in other domains of the same color. All domains of one color are therefore propagated
+ * in parallel as independent Metropolis steps, each thread operating on a private replica of the accepted
+ * and trial states. After each color, moved atoms and molecules are copied into the main states and into
+ * all replicas. The grid is randomly shifted every sweep to maintain ergodicity.
+ *
+ * The domain width is the smallest of,
+ *
+ * - the group-to-group cutoff of the non-bonded energies, if only molecules are moved, and
+ * - `cutoff` (the pair interaction range) plus twice the largest molecular radius.
+ *
+ * Each domain has its own random number generator, seeded from the move generator at the beginning of
+ * each sweep, so that results are independent of the number of threads and of their scheduling.
+ */
+class MetropolisMonteCarlo::Checkerboard {
+    struct Replica {
+        std::shared_ptr<State> state;       //!< Replica of the accepted state
+        std::shared_ptr<State> trial_state; //!< Replica of the trial state
+        Change moved;                       //!< Atoms and molecules moved since last synchronisation
+        Change atom_step;                   //!< Change of a single atom move
+        Change molecule_step;               //!< Change of a single molecule move
+    };
+    struct Statistics {
+        unsigned long long attempts = 0;
+        unsigned long long accepted = 0;
+        double square_displacement = 0.0;
+        Statistics &operator+=(const Statistics &other);
+    };
+    //! Atomic (`transrot`) or molecular (`moltransrot`) move on a single molecule type
+    struct MoveData {
+        std::string name;              //!< Name of move
+        int molid = -1;                //!< Molecule to operate on
+        bool atomic = true;            //!< Move atoms or whole molecules
+        double dp = 0.0;               //!< Molecular translational displacement
+        double dprot = 0.0;            //!< Molecular rotational displacement
+        Point dir = {1, 1, 1};         //!< Translational directions
+        Point dirrot = {0, 0, 0};      //!< Predefined axis of molecular rotation
+        double repeat = 1.0;           //!< Number of moves per atom or molecule and sweep
+        std::vector<int> group_indices; //!< Indices of groups to operate on
+        Statistics statistics;
+    };
+    struct Domain {
+        std::vector<std::vector<std::pair<int, int>>> elements; //!< Group and atom index (-1 if molecule) per move
+        std::vector<Statistics> statistics;                      //!< Statistics of current sweep per move
+        Random random;                                           //!< Seeded at the beginning of each sweep
+        int color = 0;                                           //!< Neighbouring domains differ in color
+        double energy_change = 0.0;                              //!< Energy change in current sweep (kT)
+    };
+    static constexpr int num_colors = 8;
+    std::vector<MoveData> moves;             //!< Moves to perform in each domain
+    std::vector<Replica> replicas;           //!< One replica per thread
+    std::vector<Domain> domains;             //!< All domains
+    std::vector<int> selection;              //!< Indices of domains of a single color
+    double cutoff = 0.0;                     //!< Pair interaction range; zero if unknown
+    double group_cutoff = pc::infty;         //!< Largest group-to-group cutoff between moved molecules
+    Point box_length = {0, 0, 0};            //!< Side lengths of the box
+    Point domain_length = {0, 0, 0};         //!< Side lengths of a domain
+    Point offset = {0, 0, 0};                //!< Random shift of the domain grid
+    Eigen::Vector3i num_domains = {1, 1, 1}; //!< Number of domains in each dimension
+    Change pending;                          //!< Changes of the main states since the last sweep
+
+    int domainIndex(const Point &) const;
+    double domainWidth(const Space &) const;            //!< Smallest domain width keeping domains independent
+    void setDomains(Space &, Random &);                 //!< Shift grid and assign atoms and molecules to domains
+    void propagate(int domain_index, Replica &);        //!< Metropolis steps in a single domain
+    bool moveAtom(Space &, const MoveData &, Domain &, int group_index, int atom_index, double &sqd);
+    bool moveMolecule(Space &, const MoveData &, Domain &, int group_index, double &sqd);
+    void synchronise(MetropolisMonteCarlo &);           //!< Copy moved atoms into main states and all replicas
+    static void addAtom(Change &, int group_index, int atom_index);
+    static void addGroup(Change &, int group_index);
+    static std::shared_ptr<State> replicate(const json &energy, State &, Energy::Energybase::keys key);
+
+  public:
+    Checkerboard(const json &input, const json &j, State &state);
+    void record(const Change &);          //!< Register a change of the main states made outside of sweeps
+    double sweep(MetropolisMonteCarlo &); //!< Propagate all domains and return energy change (kT)
+    void to_json(json &) const;
+};
+
+MetropolisMonteCarlo::Checkerboard::Statistics &
+MetropolisMonteCarlo::Checkerboard::Statistics::operator+=(const Statistics &other) {
+    attempts += other.attempts;
+    accepted += other.accepted;
+    square_displacement += other.square_displacement;
+    return *this;
+}
+
+/**
+ * @param input Complete user input used to build a replica for each thread
+ * @param j Checkerboard section of the input
+ * @param state Accepted state
+ */
+MetropolisMonteCarlo::Checkerboard::Checkerboard(const json &input, const json &j, State &state) {
+    auto &spc = *state.spc;
+    if (spc.geo.type != Geometry::CUBOID && spc.geo.type != Geometry::SLIT) {
+        throw ConfigurationError("checkerboard: cuboid or slit geometry required");
+    }
+    cutoff = j.value("cutoff", 0.0);
+    if (cutoff < 0.0) {
+        throw ConfigurationError("checkerboard: cutoff must be positive");
+    }
+
+    // a single atomic move may be given directly in the checkerboard section
+    const json move_list = j.contains("moves") ? j.at("moves") : json::array({{{"transrot", j}}});
+    for (const auto &item : move_list) {
+        for (const auto &[key, value] : item.items()) {
+            MoveData data;
+            data.name = key;
+            const auto molecule_name = value.at("molecule").get<std::string>();
+            const auto molecule = findName(Faunus::molecules, molecule_name);
+            if (molecule == Faunus::molecules.end()) {
+                throw ConfigurationError("checkerboard: unknown molecule '" + molecule_name + "'");
+            }
+            data.molid = molecule->id();
+            data.dir = value.value("dir", Point(1, 1, 1));
+            data.repeat = value.value("repeat", 1.0);
+            if (key == "transrot") {
+                if (not molecule->atomic) {
+                    throw ConfigurationError("checkerboard: transrot requires an atomic molecule");
+                }
+            } else if (key == "moltransrot") {
+                if (molecule->atomic) {
+                    throw ConfigurationError("checkerboard: moltransrot requires a non-atomic molecule");
+                }
+                data.atomic = false;
+                data.dp = value.at("dp").get<double>();
+                data.dprot = value.at("dprot").get<double>();
+                data.dirrot = value.value("dirrot", Point(0, 0, 0));
+            } else {
+                throw ConfigurationError("checkerboard: unknown move '" + key + "'");
+            }
+            for (auto &group : spc.findMolecules(data.molid, Space::ALL)) {
+                data.group_indices.push_back(&group - &spc.groups.front());
+            }
+            moves.push_back(data);
+        }
+    }
+    if (moves.empty()) {
+        throw ConfigurationError("checkerboard: no moves given");
+    }
+
+    // group-to-group cutoffs apply only if no atoms are moved
+    if (std::none_of(moves.begin(), moves.end(), [](const auto &data) { return data.atomic; })) {
+        if (auto nonbonded_terms = state.pot->find<Energy::NonbondedBase>(); not nonbonded_terms.empty()) {
+            group_cutoff = 0.0;
+            for (const auto &nonbonded : nonbonded_terms) {
+                for (const auto &data1 : moves) {
+                    for (const auto &data2 : moves) {
+                        group_cutoff = std::max(group_cutoff,
+                                                nonbonded->getGroupCutoff().getCutoff(data1.molid, data2.molid));
+                    }
+                }
+            }
+        }
+    }
+    if (cutoff == 0.0 && (group_cutoff == pc::infty || group_cutoff <= 0.0)) {
+        throw ConfigurationError("checkerboard: cutoff required as the interaction range is unknown");
+    }
+    if (cutoff > 0.0) {
+        for (const auto &nonbonded : state.pot->find<Energy::NonbondedBase>()) {
+            const auto &group_cutoff = nonbonded->getGroupCutoff();
+            const double pair_cutoff = std::max(group_cutoff.getPairCutoff(), group_cutoff.getPairPotentialCutoff());
+            if (cutoff < pair_cutoff) {
+                throw ConfigurationError(
+                    fmt::format("checkerboard: cutoff is shorter than the pair interaction range ({})", pair_cutoff));
+            }
+        }
+    }
+    for (const auto &term : state.pot->vec) { // energies other than these may couple distant particles
+        // states are synchronised from one replica at a time, which would overwrite accumulated energies
+        auto nonbonded = std::dynamic_pointer_cast<Energy::NonbondedBase>(term);
+        if ((nonbonded && nonbonded->isCached()) || std::dynamic_pointer_cast<Energy::ExternalAkesson>(term)) {
+            throw ConfigurationError("checkerboard: unsupported energy term '" + term->name + "'");
+        }
+        if (auto bonded = std::dynamic_pointer_cast<Energy::Bonded>(term); bonded && bonded->hasIntermolecularBonds()) {
+            throw ConfigurationError("checkerboard: intermolecular bonds may couple domains");
+        }
+        if (not(std::dynamic_pointer_cast<Energy::NonbondedBase>(term) || std::dynamic_pointer_cast<Energy::Bonded>(term) ||
+                std::dynamic_pointer_cast<Energy::ExternalPotential>(term) ||
+                std::dynamic_pointer_cast<Energy::ContainerOverlap>(term) ||
+                std::dynamic_pointer_cast<Energy::Isobaric>(term))) {
+            faunus_logger->warn("checkerboard: energy term '{}' may couple domains; check energy drift", term->name);
+        }
+    }
+
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = j.value("threads", omp_get_max_threads());
+#endif
+    replicas.resize(std::max(num_threads, 1));
+    const auto log_level = faunus_logger->level();
+    faunus_logger->set_level(spdlog::level::off); // do not duplicate log info
+    for (auto &replica : replicas) {
+        replica.state = replicate(input.at("energy"), state, Energy::Energybase::ACCEPTED_MONTE_CARLO_STATE);
+        replica.trial_state = replicate(input.at("energy"), state, Energy::Energybase::TRIAL_MONTE_CARLO_STATE);
+        replica.atom_step.groups.resize(1);
+        replica.atom_step.groups.front().internal = true;
+        replica.atom_step.groups.front().atoms.resize(1);
+        replica.molecule_step.groups.resize(1);
+        replica.molecule_step.groups.front().all = true;
+    }
+    faunus_logger->set_level(log_level);
+}
+
+/**
+ * The particles and groups are copied from `state`, whereas the Hamiltonian is built anew as its energy
+ * terms refer to their own space.
+ *
+ * @param energy Energy section of the input
+ * @param state State to copy
+ * @param key Whether the replica is an accepted or a trial state
+ */
+std::shared_ptr<MetropolisMonteCarlo::State>
+MetropolisMonteCarlo::Checkerboard::replicate(const json &energy, State &state, Energy::Energybase::keys key) {
+    Change everything;
+    everything.all = true;
+    auto replica = std::make_shared<State>();
+    replica->spc = std::make_shared<Space>();
+    replica->spc->sync(*state.spc, everything);
+    replica->pot = std::make_shared<Energy::Hamiltonian>(*replica->spc, energy);
+    replica->pot->key = key;
+    replica->pot->init();
+    return replica;
+}
+
+/**
+ * Moved groups are collected so that replicas need only copy those before the next sweep
+ */
+void MetropolisMonteCarlo::Checkerboard::record(const Change &change) {
+    if (pending.all) {
+        return;
+    }
+    if (change.all || change.dV || change.dN) {
+        pending.clear();
+        pending.all = true;
+        return;
+    }
+    for (const auto &data : change.groups) {
+        addGroup(pending, data.index);
+    }
+}
+
+int MetropolisMonteCarlo::Checkerboard::domainIndex(const Point &position) const {
+    Eigen::Vector3i cell;
+    for (int k = 0; k < 3; k++) {
+        double x = std::fmod(position[k] + 0.5 * box_length[k] - offset[k], box_length[k]);
+        if (x < 0.0) {
+            x += box_length[k];
+        }
+        cell[k] = std::min(static_cast<int>(x / domain_length[k]), num_domains[k] - 1);
+    }
+    return cell.x() + num_domains.x() * (cell.y() + num_domains.y() * cell.z());
+}
+
+/**
+ * Rigid molecules extend beyond their mass center, so that moved atoms in domains of the same color may come
+ * within `cutoff` unless the domains are widened by twice the largest molecular radius.
+ */
+double MetropolisMonteCarlo::Checkerboard::domainWidth(const Space &spc) const {
+    double width = group_cutoff;
+    if (cutoff > 0.0) {
+        double radius = 0.0;
+        for (const auto &data : moves) {
+            if (not data.atomic) {
+                for (auto group_index : data.group_indices) {
+                    const auto &group = spc.groups[group_index];
+                    for (const auto &particle : group) {
+                        radius = std::max(radius, spc.geo.sqdist(particle.pos, group.cm));
+                    }
+                }
+            }
+        }
+        const double range = cutoff + 2.0 * std::sqrt(radius);
+        width = group_cutoff > 0.0 ? std::min(width, range) : range; // domains must have a non-zero width
+    }
+    return width;
+}
+
+/**
+ * The number of domains in each dimension is the largest even number giving domains at least
+ * `domainWidth()` wide; otherwise a single domain spans the dimension. An even number is required for
+ * domains of the same color to be separated also across periodic boundaries.
+ */
+void MetropolisMonteCarlo::Checkerboard::setDomains(Space &spc, Random &random) {
+    const double width = domainWidth(spc);
+    box_length = spc.geo.getLength();
+    for (int k = 0; k < 3; k++) {
+        num_domains[k] = std::max(2 * static_cast<int>(box_length[k] / (2.0 * width)), 1);
+    }
+    domain_length = box_length.cwiseQuotient(num_domains.cast<double>());
+    for (int k = 0; k < 3; k++) {
+        offset[k] = random() * domain_length[k];
+    }
+    domains.resize(num_domains.prod());
+    for (int i = 0; i < static_cast<int>(domains.size()); i++) {
+        auto &domain = domains[i];
+        const Eigen::Vector3i cell(i % num_domains.x(), (i / num_domains.x()) % num_domains.y(),
+                                   i / (num_domains.x() * num_domains.y()));
+        domain.color = (cell.x() & 1) | (cell.y() & 1) << 1 | (cell.z() & 1) << 2;
+        domain.random.engine.seed(random.engine());
+        domain.elements.resize(moves.size());
+        for (auto &elements : domain.elements) {
+            elements.clear();
+        }
+        domain.statistics.assign(moves.size(), Statistics());
+        domain.energy_change = 0.0;
+    }
+    for (size_t m = 0; m < moves.size(); m++) {
+        for (auto group_index : moves[m].group_indices) {
+            const auto &group = spc.groups[group_index];
+            if (moves[m].atomic) {
+                for (int i = 0; i < static_cast<int>(group.size()); i++) {
+                    domains[domainIndex(group[i].pos)].elements[m].emplace_back(group_index, i);
+                }
+            } else if (not group.empty()) {
+                domains[domainIndex(group.cm)].elements[m].emplace_back(group_index, -1);
+            }
+        }
+    }
+}
+
+/**
+ * As `Move::AtomicTranslateRotate`
+ * @return True if the atom remains in the domain
+ */
+bool MetropolisMonteCarlo::Checkerboard::moveAtom(Space &spc, const MoveData &data, Domain &domain,
+                                                  int group_index, int atom_index, double &sqd) {
+    auto &particle = spc.groups[group_index][atom_index];
+    const double translational_displacement = atoms[particle.id].dp;
+    const double rotational_displacement = atoms[particle.id].dprot;
+    const Point old_position = particle.pos;
+    if (translational_displacement > 0.0) {
+        particle.pos += ranunit(domain.random, data.dir) * translational_displacement * domain.random();
+        spc.geo.boundary(particle.pos);
+    }
+    if (rotational_displacement > 0.0) {
+        Point u = ranunit(domain.random);
+        double angle = rotational_displacement * (domain.random() - 0.5);
+        Eigen::Quaterniond Q(Eigen::AngleAxisd(angle, u));
+        particle.rotate(Q, Q.toRotationMatrix());
+    }
+    sqd = spc.geo.sqdist(old_position, particle.pos);
+    return &domain == &domains[domainIndex(particle.pos)];
+}
+
+/**
+ * As `Move::TranslateRotate`
+ * @return True if the mass center remains in the domain
+ */
+bool MetropolisMonteCarlo::Checkerboard::moveMolecule(Space &spc, const MoveData &data, Domain &domain,
+                                                      int group_index, double &sqd) {
+    auto &group = spc.groups[group_index];
+    const Point old_mass_center = group.cm;
+    if (data.dp > 0.0) {
+        group.translate(ranunit(domain.random, data.dir) * data.dp * domain.random(), spc.geo.getBoundaryFunc());
+    }
+    if (data.dprot > 0.0) {
+        Point u = ranunit(domain.random);
+        if (data.dirrot.count() > 0) {
+            u = data.dirrot;
+        }
+        double angle = data.dprot * (domain.random() - 0.5);
+        Eigen::Quaterniond Q(Eigen::AngleAxisd(angle, u));
+        group.rotate(Q, spc.geo.getBoundaryFunc());
+    }
+    sqd = spc.geo.sqdist(old_mass_center, group.cm);
+    return &domain == &domains[domainIndex(group.cm)];
+}
+
+/**
+ * Moves that take an atom or molecular mass center out of its domain are rejected.
+ */
+void MetropolisMonteCarlo::Checkerboard::propagate(int domain_index, Replica &replica) {
+    auto &domain = domains[domain_index];
+    auto &spc = *replica.trial_state->spc;
+    for (size_t m = 0; m < moves.size(); m++) {
+        const auto &data = moves[m];
+        const auto &elements = domain.elements[m];
+        auto &statistics = domain.statistics[m];
+        auto &step = data.atomic ? replica.atom_step : replica.molecule_step;
+        const auto num_moves = std::lround(data.repeat * static_cast<double>(elements.size()));
+        for (long n = 0; n < num_moves; n++) {
+            const auto [group_index, atom_index] = *domain.random.sample(elements.begin(), elements.end());
+            if (data.atomic) {
+                const auto &particle = spc.groups[group_index][atom_index];
+                if (atoms[particle.id].dp <= 0.0 and atoms[particle.id].dprot <= 0.0) {
+                    continue;
+                }
+            } else if (data.dp <= 0.0 and data.dprot <= 0.0) {
+                break;
+            }
+            statistics.attempts++;
+            double sqd = 0.0;
+            const bool inside = data.atomic ? moveAtom(spc, data, domain, group_index, atom_index, sqd)
+                                            : moveMolecule(spc, data, domain, group_index, sqd);
+            step.groups.front().index = group_index;
+            if (data.atomic) {
+                step.groups.front().atoms.front() = atom_index;
+            }
+            bool accepted = false;
+            double du = 0.0;
+            if (inside) {
+                const double trial_energy = replica.trial_state->pot->energy(step);
+                const double energy = replica.state->pot->energy(step);
+                du = energyChange(energy, trial_energy);
+                accepted = metropolis(du, domain.random);
+            }
+            if (accepted) {
+                statistics.accepted++;
+                statistics.square_displacement += sqd;
+                domain.energy_change += du;
+                replica.state->sync(*replica.trial_state, step);
+                if (data.atomic) {
+                    addAtom(replica.moved, group_index, atom_index);
+                } else {
+                    addGroup(replica.moved, group_index);
+                }
+            } else {
+                replica.trial_state->sync(*replica.state, step);
+            }
+        }
+    }
+}
+
+void MetropolisMonteCarlo::Checkerboard::addAtom(Change &change, int group_index, int atom_index) {
+    auto it = std::find_if(change.groups.begin(), change.groups.end(),
+                           [group_index](const auto &data) { return data.index == group_index; });
+    if (it == change.groups.end()) {
+        it = change.groups.emplace(change.groups.end());
+        it->index = group_index;
+        it->internal = true;
+    }
+    it->atoms.push_back(atom_index);
+}
+
+void MetropolisMonteCarlo::Checkerboard::addGroup(Change &change, int group_index) {
+    auto it = std::find_if(change.groups.begin(), change.groups.end(),
+                           [group_index](const auto &data) { return data.index == group_index; });
+    if (it == change.groups.end()) {
+        it = change.groups.emplace(change.groups.end());
+        it->index = group_index;
+    }
+    it->all = true;
+}
+
+void MetropolisMonteCarlo::Checkerboard::synchronise(MetropolisMonteCarlo &mc) {
+    Change moved; // atoms and molecules moved by all replicas
+    for (auto &replica : replicas) {
+        if (not replica.moved.empty()) {
+            for (auto &data : replica.moved.groups) {
+                if (data.all) {
+                    addGroup(moved, data.index);
+                    continue;
+                }
+                std::sort(data.atoms.begin(), data.atoms.end());
+                data.atoms.erase(std::unique(data.atoms.begin(), data.atoms.end()), data.atoms.end());
+                for (auto i : data.atoms) {
+                    addAtom(moved, data.index, i);
+                }
+            }
+            mc.state->sync(*replica.state, replica.moved);
+            replica.moved.clear();
+        }
+    }
+    if (not moved.empty()) {
+        for (auto &data : moved.groups) {
+            std::sort(data.atoms.begin(), data.atoms.end());
+        }
+        std::sort(moved.groups.begin(), moved.groups.end());
+        mc.trial_state->sync(*mc.state, moved);
+        for (auto &replica : replicas) {
+            replica.state->sync(*mc.state, moved);
+            replica.trial_state->sync(*mc.state, moved);
+        }
+    }
+}
+
+/**
+ * @return Energy change of the sweep (kT)
+ */
+double MetropolisMonteCarlo::Checkerboard::sweep(MetropolisMonteCarlo &mc) {
+    if (not pending.empty()) { // catch up with other moves since the last sweep
+        std::sort(pending.groups.begin(), pending.groups.end());
+        for (auto &replica : replicas) {
+            replica.state->sync(*mc.state, pending);
+            replica.trial_state->sync(*mc.state, pending);
+        }
+        pending.clear();
+    }
+    setDomains(*mc.state->spc, Move::Movebase::slump);
+
+    for (int color = 0; color < num_colors; color++) {
+        selection.clear();
+        for (int i = 0; i < static_cast<int>(domains.size()); i++) {
+            if (domains[i].color == color) {
+                selection.push_back(i);
+            }
+        }
+        if (selection.empty()) {
+            continue;
+        }
+        std::exception_ptr exception = nullptr;
+#pragma omp parallel for schedule(dynamic) num_threads(replicas.size())
+        for (int k = 0; k < static_cast<int>(selection.size()); k++) {
+#ifdef _OPENMP
+            auto &replica = replicas[omp_get_thread_num()];
+#else
+            auto &replica = replicas.front();
+#endif
+            try {
+                propagate(selection[k], replica);
+            } catch (...) {
+#pragma omp critical
+                exception = std::current_exception(); // exceptions cannot leave the parallel region
+            }
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        synchronise(mc);
+    }
+
+    double du = 0.0;
+    for (const auto &domain : domains) {
+        du += domain.energy_change;
+        for (size_t m = 0; m < moves.size(); m++) {
+            moves[m].statistics += domain.statistics[m];
+        }
+    }
+    return du;
+}
+
+void MetropolisMonteCarlo::Checkerboard::to_json(json &j) const {
+    j = {{"threads", replicas.size()}, {"domains", num_domains.prod()}, {"domain width", domain_length.minCoeff()}};
+    if (cutoff > 0.0) {
+        j["cutoff"] = cutoff;
+    }
+    if (group_cutoff < pc::infty) {
+        j["group cutoff"] = group_cutoff;
+    }
+    auto &moves_json = j["moves"] = json::array();
+    for (const auto &data : moves) {
+        json move_json = {{"molecule", molecules[data.molid].name},
+                          {"dir", data.dir},
+                          {"repeat", data.repeat},
+                          {"moves", data.statistics.attempts}};
+        if (not data.atomic) {
+            move_json["dp"] = data.dp;
+            move_json["dprot"] = data.dprot;
+        }
+        if (data.statistics.attempts > 0) {
+            move_json["acceptance"] = double(data.statistics.accepted) / data.statistics.attempts;
+            move_json[u8::rootof + u8::bracket("r" + u8::squared)] =
+                std::sqrt(data.statistics.square_displacement / data.statistics.attempts);
+        }
+        _roundjson(move_json, 3);
+        moves_json.push_back({{data.name, move_json}});
+    }
+    _roundjson(j, 3);
+}
+
 MetropolisMonteCarlo::MetropolisMonteCarlo(const json &j, MPI::MPIController &mpi)
     : original_log_level(faunus_logger->level()) {
     state = std::make_shared<State>(j);
@@ -97,6 +695,9 @@ MetropolisMonteCarlo::MetropolisMonteCarlo(const json &j, MPI::MPIController &mp
     trial_state = std::make_shared<State>(j);     // ...for the trial state
     faunus_logger->set_level(original_log_level); // restore original log level
     moves = std::make_shared<Move::Propagator>(j, *trial_state->spc, *trial_state->pot, mpi);
+    if (auto it = j.find("checkerboard"); it != j.end()) {
+        checkerboard = std::make_shared<Checkerboard>(j, *it, *state);
+    }
     init();
 }
 
@@ -120,6 +721,52 @@ void MetropolisMonteCarlo::restore(const json &j) {
     }
 }
 
+/**
+ * Reads a binary checkpoint as written by `Analysis::SaveState` (`.cpt` files). Particles
+ * are streamed directly into the accepted state which must have been constructed from a
+ * matching topology. The trial state is synchronised by `init()`. Move statistics are
+ * restored if present in the checkpoint; the moves must then match those of the input.
+ */
+void MetropolisMonteCarlo::restore(std::istream &stream) {
+    try {
+        cereal::BinaryInputArchive archive(stream);
+        std::string magic;
+        std::uint32_t version = 0;
+        archive(magic, version);
+        if (magic != "faunus-checkpoint" || version > 1) {
+            throw std::runtime_error("unknown checkpoint format");
+        }
+        bool has_random_state = false;
+        archive(*state->spc, has_random_state);
+        if (has_random_state) {
+            std::string random_move, random_global;
+            archive(random_move, random_global);
+            Move::Movebase::slump = json::parse(random_move); // restore move random number generator
+            Faunus::random = json::parse(random_global); // restore global random number generator
+        }
+        size_t number_of_moves = 0;
+        if (version > 0) {
+            archive(number_of_moves);
+        }
+        if (number_of_moves > 0) {
+            if (number_of_moves != moves->moves().size()) {
+                throw std::runtime_error("checkpoint does not match the moves");
+            }
+            for (const auto &move : moves->moves()) {
+                std::string name;
+                archive(name);
+                if (name != move->name) {
+                    throw std::runtime_error("checkpoint does not match the move '" + move->name + "'");
+                }
+                archive(*move); // restore move statistics
+            }
+        }
+        init();
+    } catch (std::exception &e) {
+        throw std::runtime_error("error initialising simulation: "s + e.what());
+    }
+}
+
 /**
  * This propagates the system using a random MC move.
  * Flow:
@@ -140,6 +787,7 @@ void MetropolisMonteCarlo::move() {
         if (auto move_it = moves->sample(); move_it != moves->end()) { // pick random move
             Change change;                                             // stores proposed changes due to move
             auto move = *move_it;                                      // more readable like this
+            const auto start_ticks = ticks();                          // for profiling
             move->move(change);
 #ifndef NDEBUG
             // check if atom index indeed belong to the group (index)
@@ -151,39 +799,82 @@ void MetropolisMonteCarlo::move() {
                 latest_move = move;
                 double trial_energy = trial_state->pot->energy(change);    // trial potential energy (kT)
                 double energy = state->pot->energy(change);                // potential energy before move (kT)
-                double du = trial_energy - energy;                         // potential energy change (kT)
-                if (std::isnan(energy) and not std::isnan(trial_energy)) { // if NaN --> finite energy change
-                    du = pc::neg_infty;                                    // ...always accept
-                } else if (std::isnan(trial_energy)) {                     // if moving to NaN, e.g. division by zero,
-                    du = pc::infty;                                        // ...always reject
-                } else if (std::isnan(du)) { // if difference is NaN, e.g. infinity - infinity,
-                    du = 0.0;                // ...always accept
-                }
+                double du = energyChange(energy, trial_energy);            // potential energy change (kT)
                 double move_bias = move->bias(change, energy, trial_energy); // moves *may* add bias (kT)
                 double density_bias = TranslationalEntropy(*trial_state->spc, *state->spc).energy(change);
                 if (std::isnan(du + move_bias)) {
                     faunus_logger->error("NaN energy change in {} move.", move->name);
                     // throw exception here?
                 }
-                if (metropolis(du + move_bias + density_bias)) { // accept move
+                const bool accepted = metropolis(du + move_bias + density_bias);
+                if (accepted) {
                     state->sync(*trial_state, change);
                     move->accept(change);
-                } else { // reject move
+                    if (checkerboard) {
+                        checkerboard->record(change);
+                    }
+                } else {
                     trial_state->sync(*state, change);
                     move->reject(change);
                     du = 0.0;
                 }
                 sum_of_energy_changes += du;                              // sum of all energy changes
                 average_energy += initial_energy + sum_of_energy_changes; // update average potential energy
+
+                const auto stop_ticks = ticks();
+                const auto category = categorize(change);
+                auto &statistics = change_statistics[category];
+                statistics.calls++;
+                statistics.accepted += accepted;
+                statistics.ticks += stop_ticks - start_ticks;
+                if (trace && !trace->full()) {
+                    trace->event(move->name, change_category_names[category], start_ticks, stop_ticks,
+                                 {{"du", du}, {"accepted", accepted}});
+                }
             }
         }
     }
+    if (checkerboard) {
+        const auto start_ticks = ticks();
+        const double du = checkerboard->sweep(*this);
+        sum_of_energy_changes += du;
+        average_energy += initial_energy + sum_of_energy_changes;
+        if (trace && !trace->full()) {
+            trace->event("checkerboard", change_category_names[ATOM], start_ticks, ticks(), {{"du", du}});
+        }
+    }
+}
+
+const std::array<std::string, MetropolisMonteCarlo::NUM_CHANGE_CATEGORIES>
+    MetropolisMonteCarlo::change_category_names = {"atom", "group", "groups", "volume", "particle number", "everything"};
+
+MetropolisMonteCarlo::ChangeCategory MetropolisMonteCarlo::categorize(const Change &change) {
+    if (change.all) {
+        return EVERYTHING;
+    } else if (change.dV) {
+        return VOLUME;
+    } else if (change.dN) {
+        return PARTICLE_NUMBER;
+    } else if (change.groups.size() == 1) {
+        return (change.groups.front().atoms.size() == 1) ? ATOM : GROUP;
+    }
+    return GROUPS;
+}
+
+/**
+ * @param filename Output file in the Chrome trace event format
+ */
+void MetropolisMonteCarlo::setTrace(const std::string &filename) {
+    trace = std::make_shared<ChromeTraceWriter>(filename);
+    faunus_logger->info("writing trace of moves to {}", filename);
 }
 
 Energy::Hamiltonian &MetropolisMonteCarlo::getHamiltonian() { return *state->pot; }
 
 Space &MetropolisMonteCarlo::getSpace() { return *state->spc; }
 
+const Move::Propagator &MetropolisMonteCarlo::getMoves() const { return *moves; }
+
 void from_json(const json &j, MetropolisMonteCarlo::State &state) {
     state.spc = std::make_shared<Space>(j);
     state.pot = std::make_shared<Energy::Hamiltonian>(*state.spc, j.at("energy"));
@@ -200,6 +891,21 @@ void to_json(json &j, const MetropolisMonteCarlo &mc) {
     j["moves"] = *mc.moves;
     j["energy"].push_back(*mc.state->pot);
     j["montecarlo"] = {{"average potential energy (kT)", mc.average_energy.avg()}, {"last move", mc.latest_move->name}};
+    if (mc.checkerboard) {
+        mc.checkerboard->to_json(j["checkerboard"]);
+    }
+
+    auto &profile = j["profile"] = json::object(); // time spent per category of change
+    for (size_t i = 0; i < mc.change_statistics.size(); ++i) {
+        if (const auto &statistics = mc.change_statistics[i]; statistics.calls > 0) {
+            const double seconds = statistics.ticks * secondsPerTick();
+            profile[MetropolisMonteCarlo::change_category_names[i]] = {
+                {"moves", statistics.calls},
+                {"acceptance", double(statistics.accepted) / statistics.calls},
+                {"time (s)", seconds},
+                {"time per move (" + u8::mu + "s)", 1.0e6 * seconds / statistics.calls}};
+        }
+    }
 }
 
 TranslationalEntropy::TranslationalEntropy(Space &trial_space, Space &space) : trial_spc(trial_space), spc(space) {}
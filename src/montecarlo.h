@@ -3,6 +3,7 @@
 #define FAUNUS_MONTECARLO_H
 
 #include "space.h"
+#include <array>
 #include <memory>
 
 namespace Faunus {
@@ -20,6 +21,8 @@ namespace MPI {
 class MPIController;
 }
 
+class ChromeTraceWriter;
+
 /**
  * @brief Class to handle Monte Carlo moves
  *
@@ -68,15 +71,37 @@ class MetropolisMonteCarlo {
     double initial_energy = 0.0;                  //!< Initial potential energy
     Average<double> average_energy;               //!< Average potential energy of the system
     bool metropolis(double du) const;             //!< Metropolis criterion
+    static bool metropolis(double du, Random &);  //!< Metropolis criterion using given random number generator
+    static double energyChange(double energy, double trial_energy); //!< Energy change w. handling of NaN
     void init();                                  //!< Reset state
 
+    class Checkerboard;                        //!< Parallel sweeps of atomic and molecular moves
+    std::shared_ptr<Checkerboard> checkerboard; //!< Optional checkerboard sweep performed after each set of moves
+
+    //! Categories of changes for profiling
+    enum ChangeCategory { ATOM, GROUP, GROUPS, VOLUME, PARTICLE_NUMBER, EVERYTHING, NUM_CHANGE_CATEGORIES };
+    static const std::array<std::string, NUM_CHANGE_CATEGORIES> change_category_names;
+    static ChangeCategory categorize(const Change &); //!< Category of a change
+
+    //! Number of moves and time spent on move, energy evaluation, and acceptance for a category of change
+    struct ChangeStatistics {
+        unsigned long long calls = 0;
+        unsigned long long accepted = 0;
+        uint64_t ticks = 0; //!< see `ticks()`
+    };
+    std::array<ChangeStatistics, NUM_CHANGE_CATEGORIES> change_statistics;
+    std::shared_ptr<ChromeTraceWriter> trace; //!< Optional trace of all moves
+
   public:
     MetropolisMonteCarlo(const json &, MPI::MPIController &);
     Energy::Hamiltonian &getHamiltonian();                     //!< Get Hamiltonian of accepted (default) state
     Space &getSpace();                                         //!< Access to space in accepted (default) state
+    const Move::Propagator &getMoves() const;                  //!< Registered MC moves
     double relativeEnergyDrift();                              //!< Relative energy drift from initial configuration
     void move();                                               //!< Perform random Monte Carlo move
     void restore(const json &);                                //!< Restores system from previously store json object
+    void restore(std::istream &);                              //!< Restores system from binary checkpoint stream
+    void setTrace(const std::string &);                        //!< Write Chrome trace of all moves to file
     friend void to_json(json &, const MetropolisMonteCarlo &); //!< Write information to JSON object
 };
 
@@ -0,0 +1,220 @@
+#pragma once
+#include "montecarlo.h"
+#include "analysis.h"
+#include "mpicontroller.h"
+#include "move.h"
+#include <functional>
+
+namespace Faunus {
+
+/**
+ * @brief Runs a short simulation from default seeded random number generators
+ *
+ * Checks that the energy drift is negligible and that particles have moved.
+ *
+ * @param input Complete input; also sets the global atom and molecule lists
+ * @param sweeps Number of calls to `MetropolisMonteCarlo::move()`
+ * @param sample Optionally called after each sweep
+ * @return Particles of the final configuration
+ */
+inline ParticleVector runSimulation(const json &input, int sweeps,
+                                    const std::function<void(MetropolisMonteCarlo &)> &sample = nullptr) {
+    Faunus::atoms = input.at("atomlist").get<decltype(atoms)>();
+    Faunus::molecules = input.at("moleculelist").get<decltype(molecules)>();
+    Faunus::random = Random();
+    Move::Movebase::slump = Random();
+    MetropolisMonteCarlo simulation(input, MPI::mpi);
+    const auto initial_positions = simulation.getSpace().p;
+    for (int sweep = 0; sweep < sweeps; sweep++) {
+        simulation.move();
+        if (sample) {
+            sample(simulation);
+        }
+    }
+    CHECK(std::fabs(simulation.relativeEnergyDrift()) < 1e-10);
+    const auto &positions = simulation.getSpace().p;
+    CHECK_FALSE(std::equal(positions.begin(), positions.end(), initial_positions.begin(), initial_positions.end(),
+                           [](const auto &a, const auto &b) { return a.pos == b.pos; }));
+    return positions;
+}
+
+TEST_SUITE_BEGIN("MonteCarlo");
+
+TEST_CASE("[Faunus] Checkerboard") {
+    json input = R"({
+        "geometry": {"type": "cuboid", "length": 40},
+        "atomlist": [
+            {"Na": {"sigma": 3.0, "eps": 0.5, "dp": 2.0}},
+            {"Cl": {"sigma": 4.0, "eps": 0.5, "dp": 2.0}}
+        ],
+        "moleculelist": [ {"salt": {"atomic": true, "atoms": ["Na", "Cl"]}} ],
+        "insertmolecules": [ {"salt": {"N": 100}} ],
+        "energy": [ {"nonbonded": {"default": [ {"wca": {"mixing": "LB"}} ]}} ],
+        "moves": [],
+        "checkerboard": {"molecule": "salt", "cutoff": 5.0}
+    })"_json;
+
+    auto equalPositions = [](const ParticleVector &a, const ParticleVector &b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](const auto &i, const auto &j) {
+                   return i.pos == j.pos;
+               });
+    };
+
+    // all sweeps start from the same seed and initial configuration
+    auto simulate = [&](int threads) {
+        input["checkerboard"]["threads"] = threads;
+        return runSimulation(input, 20);
+    };
+
+    const auto positions = simulate(1);
+    const auto parallel_positions = simulate(4);
+    CHECK(equalPositions(positions, parallel_positions));
+}
+
+TEST_CASE("[Faunus] Checkerboard - molecular moves") {
+    // dimers with a radius of 2 Å next to salt
+    json input = R"({
+        "geometry": {"type": "cuboid", "length": 40},
+        "atomlist": [
+            {"Na": {"sigma": 3.0, "eps": 0.5, "dp": 2.0}},
+            {"Cl": {"sigma": 4.0, "eps": 0.5, "dp": 2.0}}
+        ],
+        "moleculelist": [
+            {"salt": {"atomic": true, "atoms": ["Na", "Cl"]}},
+            {"dimer": {"rigid": true, "structure": [ {"Na": [0.0, 0.0, 0.0]}, {"Cl": [4.0, 0.0, 0.0]} ]}}
+        ],
+        "insertmolecules": [ {"salt": {"N": 50}}, {"dimer": {"N": 30}} ],
+        "energy": [ {"nonbonded": {"default": [ {"wca": {"mixing": "LB"}} ], "cutoff_g2g": 12.0}} ],
+        "moves": [],
+        "checkerboard": {"moves": [ {"moltransrot": {"molecule": "dimer", "dp": 1.0, "dprot": 0.5}} ]}
+    })"_json;
+
+    auto domain_width = [&](int threads) {
+        input["checkerboard"]["threads"] = threads;
+        double width = 0.0;
+        const auto positions = runSimulation(input, 10, [&](MetropolisMonteCarlo &simulation) {
+            json j;
+            to_json(j, simulation);
+            width = j.at("checkerboard").at("domain width").get<double>();
+        });
+        return std::make_pair(width, positions);
+    };
+
+    SUBCASE("Domains from group cutoff") {
+        const auto [width, positions] = domain_width(1);
+        CHECK(width >= 12.0);
+        const auto parallel_positions = domain_width(4).second;
+        CHECK(std::equal(positions.begin(), positions.end(), parallel_positions.begin(), parallel_positions.end(),
+                         [](const auto &a, const auto &b) { return a.pos == b.pos; }));
+    }
+
+    SUBCASE("Domains widened by molecular radius") {
+        // atoms are moved as well, so the pair cutoff is widened by twice the dimer radius
+        input["checkerboard"]["cutoff"] = 5.0;
+        input["checkerboard"]["moves"].push_back({{"transrot", {{"molecule", "salt"}}}});
+        const auto width = domain_width(2).first;
+        CHECK(width >= 5.0 + 2.0 * 2.0);
+        CHECK(width < 12.0);
+    }
+}
+
+TEST_CASE("[Faunus] Checkpoint") {
+    json input = R"({
+        "geometry": {"type": "cuboid", "length": 40},
+        "atomlist": [
+            {"Na": {"sigma": 3.0, "eps": 0.5, "dp": 2.0}},
+            {"Cl": {"sigma": 4.0, "eps": 0.5, "dp": 2.0}}
+        ],
+        "moleculelist": [ {"salt": {"atomic": true, "atoms": ["Na", "Cl"]}} ],
+        "insertmolecules": [ {"salt": {"N": 20}} ],
+        "energy": [ {"nonbonded": {"default": [ {"wca": {"mixing": "LB"}} ]}} ],
+        "moves": [ {"transrot": {"molecule": "salt", "repeat": 10}} ]
+    })"_json;
+    Faunus::atoms = input.at("atomlist").get<decltype(atoms)>();
+    Faunus::molecules = input.at("moleculelist").get<decltype(molecules)>();
+    Faunus::random = Random();
+    Move::Movebase::slump = Random();
+
+    // move statistics of all moves
+    auto statistics = [](const MetropolisMonteCarlo &simulation) {
+        std::vector<json> counters;
+        for (const auto &move : simulation.getMoves().moves()) {
+            json j;
+            move->to_json(j);
+            counters.push_back({j.at("moves"), j.at("accepted"), j.at("rejected")});
+        }
+        return counters;
+    };
+
+    const std::string file = "checkpoint_test.cpt";
+    MetropolisMonteCarlo simulation(input, MPI::mpi);
+    for (int sweep = 0; sweep < 10; sweep++) {
+        simulation.move();
+    }
+    {
+        Analysis::SaveState checkpoint(R"({"file": "checkpoint_test.cpt", "saverandom": true})"_json,
+                                       simulation.getSpace(), &simulation.getMoves());
+    } // written upon destruction
+    const json random_move = Move::Movebase::slump;
+    const json random_global = Faunus::random;
+    REQUIRE(statistics(simulation).front().at(0) > 0);
+
+    Faunus::random.seed(); // a different initial configuration and random state
+    Move::Movebase::slump.seed();
+    MetropolisMonteCarlo restored(input, MPI::mpi);
+    CHECK(json(Faunus::random) != random_global);
+    std::ifstream stream(file, std::ios::binary);
+    REQUIRE(stream);
+    restored.restore(stream);
+    stream.close();
+    std::remove(file.c_str());
+
+    const auto &positions = simulation.getSpace().p;
+    const auto &restored_positions = restored.getSpace().p;
+    CHECK(std::equal(positions.begin(), positions.end(), restored_positions.begin(), restored_positions.end(),
+                     [](const auto &a, const auto &b) { return a.pos == b.pos; }));
+    CHECK(json(Move::Movebase::slump) == random_move);
+    CHECK(json(Faunus::random) == random_global);
+    CHECK(statistics(restored) == statistics(simulation));
+}
+
+TEST_CASE("[Faunus] WidomInsertion - parallel") {
+    // ghost insertions on several threads must sample the same excess chemical potential as serial insertion
+    json input = R"({
+        "geometry": {"type": "cuboid", "length": 30},
+        "atomlist": [ {"A": {"sigma": 3.0, "eps": 0.5}} ],
+        "moleculelist": [ {"fluid": {"atomic": true, "atoms": ["A"]}},
+                          {"probe": {"rigid": true, "structure": [ {"A": [0.0, 0.0, 0.0]}, {"A": [3.0, 0.0, 0.0]} ]}} ],
+        "insertmolecules": [ {"fluid": {"N": 200}}, {"probe": {"N": 1, "inactive": true}} ],
+        "energy": [ {"nonbonded": {"default": [ {"wca": {"mixing": "LB"}} ]}} ]
+    })"_json;
+    Faunus::atoms = input.at("atomlist").get<decltype(atoms)>();
+    Faunus::molecules = input.at("moleculelist").get<decltype(molecules)>();
+    Faunus::random = Random();
+    Space spc;
+    from_json(input, spc);
+    Energy::Hamiltonian hamiltonian(spc, input.at("energy"));
+    hamiltonian.key = Energy::Energybase::ACCEPTED_MONTE_CARLO_STATE;
+    hamiltonian.init();
+    const auto initial_positions = spc.p;
+
+    auto excess = [&](bool parallel) {
+        Faunus::random = Random(); // same seed for both runs
+        const json widom_input = {{"molecule", "probe"}, {"ninsert", 20000}, {"nstep", 1}, {"parallel", parallel}};
+        Analysis::WidomInsertion widom(widom_input, spc, hamiltonian);
+        widom.sample();
+        json j;
+        widom.to_json(j);
+        return j.at("widom").at(u8::mu + "/kT").at("excess").get<double>();
+    };
+    const auto serial_excess = excess(false);
+    const auto parallel_excess = excess(true);
+    CHECK(serial_excess > 0.5); // the probe must feel the fluid
+    CHECK(parallel_excess == doctest::Approx(serial_excess).epsilon(0.05));
+    CHECK(std::equal(spc.p.begin(), spc.p.end(), initial_positions.begin(), initial_positions.end(),
+                     [](const auto &a, const auto &b) { return a.pos == b.pos; }));
+}
+
+TEST_SUITE_END();
+
+} // namespace Faunus
@@ -31,9 +31,13 @@ void Movebase::to_json(json &j) const {
     _to_json(j);
     if (timer_move.result() > 0.01) // only print if more than 1% of the time
         j["relative time (without energy calc)"] = timer_move.result();
-    if (timer.result() > 0.01) // only print if more than 1% of the time
+    if (timer.result() > 0.01) { // only print if more than 1% of the time
         j["relative time"] = timer.result();
+        j["time (s)"] = timer.seconds();
+    }
     j["acceptance"] = double(accepted) / cnt;
+    j["accepted"] = accepted;
+    j["rejected"] = rejected;
     j["repeat"] = repeat;
     j["moves"] = cnt;
     if (!cite.empty())
@@ -218,6 +222,8 @@ Propagator::Propagator(const json &j, Space &spc, Energy::Hamiltonian &pot, MPI:
                     _moves.emplace_back<Move::PivotMove>(spc);
                 else if (it.key() == "crankshaft")
                     _moves.emplace_back<Move::CrankshaftMove>(spc);
+                else if (it.key() == "regrowth")
+                    _moves.emplace_back<Move::RegrowthMove>(spc, pot);
                 else if (it.key() == "volume")
                     _moves.emplace_back<Move::VolumeMove>(spc);
                 else if (it.key() == "charge")
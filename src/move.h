@@ -43,6 +43,9 @@ class Movebase {
     virtual double bias(Change &, double,
                         double); //!< adds extra energy change not captured by the Hamiltonian
     inline virtual ~Movebase() = default;
+
+    /** @brief Cereal serialisation of the move statistics; used for binary checkpoints */
+    template <class Archive> void serialize(Archive &archive) { archive(cnt, accepted, rejected); }
 };
 
 void from_json(const json &, Movebase &); //!< Configure any move via json
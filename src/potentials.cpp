@@ -1,8 +1,12 @@
 #include "potentials.h"
 #include "multipole.h"
+#include "molecule.h"
 #include "units.h"
 #include "spdlog/spdlog.h"
 #include <coulombgalore.h>
+#include <cstdio>
+#include <fstream>
+#include <random>
 
 namespace Faunus {
 namespace Potential {
@@ -270,6 +274,63 @@ void CustomPairPotential::from_json(const json &j) {
     _j["Rc"] = std::sqrt(Rc2);
     _j["T"] = pc::temperature;
     expr.set(jin, {{"r", &d->r}, {"q1", &d->q1}, {"q2", &d->q2}, {"s1", &d->s1}, {"s2", &d->s2}});
+    tabulate = j.value("tabulate", false);
+    if (tabulate) {
+        createTables(j);
+    }
+}
+
+/**
+ * The expression is splined along r^2 in the interval [`rmin`,`rmax`] for every pair of non-implicit
+ * atom types present in the molecules or reactions; other pairs have empty tables and evaluate the
+ * expression. By default `rmin` is the contact distance, or 1 Å if the contact distance is zero,
+ * and `rmax` the cutoff.
+ */
+void CustomPairPotential::createTables(const json &j) {
+    spline.setTolerance(j.value("utol", 1e-3), j.value("ftol", 1e-2));
+    const double rmax = j.value("rmax", std::sqrt(Rc2));
+    if (!std::isfinite(rmax)) {
+        throw ConfigurationError(name + ": tabulation requires a finite cutoff or rmax");
+    }
+    std::vector<bool> is_present(atoms.size(), false); // atom types found in molecules or created by reactions
+    for (const auto &molecule : molecules) {
+        for (auto id : molecule.atoms) {
+            is_present.at(id) = true;
+        }
+    }
+    auto add_atoms = [&](const ReactionData::TStoichiometryMap &stoichiometry) {
+        for (const auto &[id, nu] : stoichiometry) {
+            is_present.at(id) = true;
+        }
+    };
+    for (const auto &reaction : reactions) {
+        add_atoms(reaction.getReactants().first);
+        add_atoms(reaction.getProducts().first);
+    }
+    tables.resize(atoms.size());
+    for (size_t i = 0; i < atoms.size(); ++i) {
+        for (size_t k = 0; k <= i; ++k) {
+            if (!is_present[i] || !is_present[k] || atoms[i].implicit || atoms[k].implicit) {
+                continue;
+            }
+            const double contact_distance = 0.5 * (atoms[i].sigma + atoms[k].sigma);
+            const double rmin = j.value("rmin", contact_distance > 0.0 ? contact_distance : 1.0_angstrom);
+            if (rmin <= 0.0 || rmin >= rmax) {
+                throw ConfigurationError(name + ": tabulation requires 0 < rmin < rmax");
+            }
+            auto expression = [&](double r2) {
+                d->r = std::sqrt(r2);
+                d->q1 = atoms[i].charge;
+                d->q2 = atoms[k].charge;
+                d->s1 = atoms[i].sigma;
+                d->s2 = atoms[k].sigma;
+                return expr();
+            };
+            tables.set(i, k, spline.generate(expression, rmin * rmin, rmax * rmax));
+            faunus_logger->debug("{}: {}-{} tabulated in [{:.2f}:{:.2f}] using {} knots", name, atoms[i].name,
+                                 atoms[k].name, std::sqrt(tables(i, k).rmin2), rmax, tables(i, k).numKnots());
+        }
+    }
 }
 
 void CustomPairPotential::to_json(json &j) const {
@@ -277,8 +338,14 @@ void CustomPairPotential::to_json(json &j) const {
     if (std::isfinite(Rc2))
         j["cutoff"] = std::sqrt(Rc2);
 }
+/**
+ * The expression variables are bound to a single shared `Data` object and
+ * the potential is therefore not thread-safe.
+ */
 CustomPairPotential::CustomPairPotential(const std::string &name)
-    : PairPotentialBase(name), d(std::make_shared<Data>()) {}
+    : PairPotentialBase(name), d(std::make_shared<Data>()) {
+    thread_safe = false;
+}
 
 // =============== Dummy ===============
 
@@ -413,8 +480,10 @@ FunctorPotential::uFunc FunctorPotential::combineFunc(json &j) {
                 for (auto it : i.items()) {
                     uFunc _u = nullptr;
                     try {
-                        if (it.key() == "custom")
+                        if (it.key() == "custom") {
                             _u = CustomPairPotential() = it.value();
+                            thread_safe = false;
+                        }
 
                         // add Coulomb potential and self-energy
                         // terms if not already added
@@ -491,6 +560,7 @@ void FunctorPotential::to_json(json &j) const {
 void FunctorPotential::from_json(const json &j) {
     have_monopole_self_energy = false;
     have_dipole_self_energy = false;
+    thread_safe = true;
     _j = j;
     umatrix = decltype(umatrix)(atoms.size(), combineFunc(_j.at("default")));
     for (auto it = _j.begin(); it != _j.end(); ++it) {
@@ -605,6 +675,18 @@ double SplinedPotential::findUpperDistance(int i, int j, double energy_threshold
     return rmax;
 }
 
+/**
+ * @brief 64-bit FNV-1a hash which, unlike `std::hash`, is stable across platforms and runs
+ */
+static uint64_t fnv1aHash(const std::string &data) {
+    uint64_t hash = 14695981039346656037ull;
+    for (const auto character : data) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
 void SplinedPotential::from_json(const json &js) {
     FunctorPotential::from_json(js);
     if (!isotropic) {
@@ -617,24 +699,52 @@ void SplinedPotential::from_json(const json &js) {
 
     faunus_logger->trace("Pair potential spline tolerance = {} kT", js.value("utol", 1e-5));
 
-    for (size_t i = 0; i < Faunus::atoms.size(); ++i) { // loop over atom types
-        for (size_t j = 0; j <= i; ++j) {               // and build matrix of spline data (knots) for each pair
-            if (atoms[i].implicit || atoms[j].implicit) {
-                continue;
+    std::vector<std::pair<int, int>> pairs; // atom pairs to spline
+    for (size_t i = 0; i < Faunus::atoms.size(); ++i) {
+        for (size_t j = 0; j <= i; ++j) {
+            if (!atoms[i].implicit && !atoms[j].implicit) {
+                pairs.emplace_back(i, j);
             }
-            double rmin = 0.5 * (Faunus::atoms[i].sigma + Faunus::atoms[j].sigma);
-            double rmax = js.value("rmax", rmin * 10);
-            if (auto it = js.find("cutoff_g2g"); it != js.end()) {
-                if (it->is_number()) {
-                    rmax = it->get<double>();
-                } else if (it->is_object()) {
-                    rmax = it->at("default").get<double>();
+        }
+    }
+
+    cache_filename.clear();
+    if (js.value("cache", false)) { // knots depend on cache version, input, atom properties, and temperature
+        const auto content = std::to_string(cache_version) + js.dump() + json(Faunus::atoms).dump() +
+                             std::to_string(pc::temperature);
+        cache_filename = fmt::format("spline-cache-{:016x}.json", fnv1aHash(content));
+    }
+
+    matrix_of_knots.resize(Faunus::atoms.size()); // no resizing when setting knots concurrently
+    if (cache_filename.empty() || !loadKnots(cache_filename, pairs)) {
+        std::exception_ptr exception = nullptr;
+#pragma omp parallel for schedule(dynamic) if (thread_safe)
+        for (size_t n = 0; n < pairs.size(); ++n) {
+            try {
+                const auto [i, j] = pairs[n];
+                double rmin = 0.5 * (Faunus::atoms[i].sigma + Faunus::atoms[j].sigma);
+                double rmax = js.value("rmax", rmin * 10);
+                if (auto it = js.find("cutoff_g2g"); it != js.end()) {
+                    if (it->is_number()) {
+                        rmax = it->get<double>();
+                    } else if (it->is_object()) {
+                        rmax = it->at("default").get<double>();
+                    }
                 }
+                rmin = findLowerDistance(i, j, energy_at_rmin, rmin);
+                rmax = findUpperDistance(i, j, energy_at_rmax, rmax);
+                assert(rmin < rmax);
+                createKnots(i, j, rmin, rmax);
+            } catch (...) {
+#pragma omp critical
+                exception = std::current_exception(); // exceptions cannot leave the parallel region
             }
-            rmin = findLowerDistance(i, j, energy_at_rmin, rmin);
-            rmax = findUpperDistance(i, j, energy_at_rmax, rmax);
-            assert(rmin < rmax);
-            createKnots(i, j, rmin, rmax);
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        if (!cache_filename.empty()) {
+            saveKnots(cache_filename, pairs);
         }
     }
     if (js.value("to_disk", false)) {
@@ -642,8 +752,66 @@ void SplinedPotential::from_json(const json &js) {
     }
 }
 
+/**
+ * @param filename Cache file
+ * @param pairs Atom pairs that must be present in the cache
+ * @return True if knots for all pairs were loaded
+ */
+bool SplinedPotential::loadKnots(const std::string &filename, const std::vector<std::pair<int, int>> &pairs) {
+    if (auto stream = std::ifstream(filename); stream) {
+        try {
+            const auto j = json::parse(stream);
+            if (const auto version = j.at("version").get<int>(); version != cache_version) {
+                throw std::runtime_error(fmt::format("version {} differs from {}", version, cache_version));
+            }
+            for (const auto [i, k] : pairs) {
+                const auto &knots_json = j.at(fmt::format("{} {}", i, k));
+                KnotData knots;
+                knots.rmin2 = knots_json.at("rmin2").get<double>();
+                knots.rmax2 = knots_json.at("rmax2").get<double>();
+                knots.r2 = knots_json.at("r2").get<std::vector<double>>();
+                knots.c = knots_json.at("c").get<std::vector<double>>();
+                knots.hardsphere_repulsion = knots_json.at("hardsphere").get<bool>();
+                matrix_of_knots.set(i, k, knots);
+            }
+            faunus_logger->info("{}: spline knots loaded from {}", name, filename);
+            return true;
+        } catch (const std::exception &e) {
+            faunus_logger->warn("{}: ignoring spline cache {}: {}", name, filename, e.what());
+        }
+    }
+    return false;
+}
+
+/**
+ * The cache is written to a temporary file which is then renamed, so that
+ * concurrent jobs never read a partially written cache.
+ */
+void SplinedPotential::saveKnots(const std::string &filename, const std::vector<std::pair<int, int>> &pairs) const {
+    json j = {{"version", cache_version}};
+    for (const auto [i, k] : pairs) {
+        const auto &knots = matrix_of_knots(i, k);
+        j[fmt::format("{} {}", i, k)] = {{"rmin2", knots.rmin2},
+                                         {"rmax2", knots.rmax2},
+                                         {"r2", knots.r2},
+                                         {"c", knots.c},
+                                         {"hardsphere", knots.hardsphere_repulsion}};
+    }
+    const auto tmp_filename = fmt::format("{}.{}.tmp", filename, std::random_device()()); // unique per process
+    if (auto stream = std::ofstream(tmp_filename); stream) {
+        stream << j;
+    }
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+        faunus_logger->warn("{}: could not write spline cache {}", name, filename);
+    } else {
+        faunus_logger->debug("{}: spline knots saved to {}", name, filename);
+    }
+}
+
 SplinedPotential::SplinedPotential(const std::string &name) : FunctorPotential(name) {}
 
+const std::string &SplinedPotential::getCacheFilename() const { return cache_filename; }
+
 /**
  * @param i Atom index
  * @param j Atom index
@@ -118,6 +118,7 @@ struct PairPotentialBase {
     std::string name; //!< unique name per polymorphic call; used in FunctorPotential::combineFunc
     std::string cite; //!< Typically a short-doi litterature reference
     bool isotropic = true; //!< true if pair-potential is independent of particle orientation
+    bool thread_safe = true; //!< false if the potential cannot be evaluated concurrently from several threads
     std::function<double(const Particle &)> selfEnergy = nullptr; //!< self energy of particle (kT)
     virtual void to_json(json &) const = 0;
     virtual void from_json(const json &) = 0;
@@ -180,6 +181,7 @@ template <class T1, class T2> struct CombinedPairPotential : public PairPotentia
         Faunus::Potential::from_json(j, first);
         Faunus::Potential::from_json(j, second);
         name = first.name + "/" + second.name;
+        thread_safe = first.thread_safe && second.thread_safe;
         if (first.selfEnergy or second.selfEnergy) { // combine self-energies
             selfEnergy = [u1 = first.selfEnergy, u2 = second.selfEnergy](const Particle &p) {
                 if (u1 and u2) {
@@ -600,6 +602,11 @@ class Multipole : public NewCoulombGalore {
 
 /**
  * @brief Custom pair-potential taking math. expressions at runtime
+ *
+ * If `tabulate` is set, the expression is splined for each pair of atom types at start-up
+ * in the interval [`rmin`,`rmax`] using the atom type charges and radii. The expression is
+ * then evaluated only outside the interval, or if a particle charge differs from that of
+ * its atom type.
  */
 class CustomPairPotential : public PairPotentialBase {
   private:
@@ -612,10 +619,20 @@ class CustomPairPotential : public PairPotentialBase {
     double Rc2;
     std::shared_ptr<Data> d;
     json jin; // initial json input
+    bool tabulate = false;                                    //!< Use tabulated expression where available
+    Tabulate::Andrea<double> spline;                          //!< Spline method
+    PairMatrix<Tabulate::TabulatorBase<double>::data> tables; //!< Tabulated expression for each atom pair
+    void createTables(const json &);                          //!< Spline expression for all atom pairs
   public:
     inline double operator()(const Particle &a, const Particle &b, double r2, const Point &) const override {
         if (r2 > Rc2)
             return 0;
+        if (tabulate && a.charge == atoms[a.id].charge && b.charge == atoms[b.id].charge) {
+            const auto &table = tables(a.id, b.id);
+            if (r2 > table.rmin2 && r2 <= table.rmax2) {
+                return spline.eval(table, r2);
+            }
+        }
         d->r = sqrt(r2);
         d->q1 = a.charge;
         d->q2 = b.charge;
@@ -704,6 +721,10 @@ class FunctorPotential : public PairPotentialBase {
  * The spline range is automatically detected based on user-defined
  * energy thresholds. If below the range, the default behavior is to return
  * the EXACT energy, while if above ZERO is returned.
+ *
+ * Knots for different atom pairs are generated in parallel (OpenMP), and can
+ * optionally be cached on disk in a file named after a hash of the cache version,
+ * input, atom properties, and temperature.
  */
 class SplinedPotential : public FunctorPotential {
     /** @brief Expand spline data class to hold information about the sign of values for r<rmin */
@@ -725,9 +746,14 @@ class SplinedPotential : public FunctorPotential {
     double findUpperDistance(int, int, double, double);   //!< Find upper distance for splining (rmax)
     double dr = 1e-2;                                     //!< Distance interval when searching for rmin and rmax
     void createKnots(int, int, double, double);           //!< Create spline knots for pair of particles in [rmin:rmax]
+    static constexpr int cache_version = 1; //!< Bump when the cache layout or the knot generation changes
+    std::string cache_filename;             //!< Spline cache file; empty if caching is disabled
+    bool loadKnots(const std::string &, const std::vector<std::pair<int, int>> &); //!< Load knots from disk cache
+    void saveKnots(const std::string &, const std::vector<std::pair<int, int>> &) const; //!< Save knots to disk cache
 
   public:
     explicit SplinedPotential(const std::string &name = "splined");
+    const std::string &getCacheFilename() const; //!< Spline cache file; empty if caching is disabled
 
     /**
      * Policies:
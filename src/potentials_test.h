@@ -1,4 +1,8 @@
 #include "potentials.h"
+#include <fstream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace Faunus {
 namespace Potential {
@@ -240,9 +244,13 @@ TEST_SUITE_END();
 TEST_CASE("[Faunus] CustomPairPotential") {
     json j = R"({ "atomlist" : [
                  {"A": { "q":1.0,  "r":3, "eps":0.1 }},
-                 {"B": { "q":-1.0, "r":4, "eps":0.05 }} ]})"_json;
+                 {"B": { "q":-1.0, "r":4, "eps":0.05 }},
+                 {"C": { "q":1.0,  "r":0 }} ],
+               "moleculelist" : [ {"salt": {"atomic": true, "atoms": ["A", "B", "C"]}} ]})"_json;
 
     atoms = j["atomlist"].get<decltype(atoms)>();
+    molecules = j["moleculelist"].get<decltype(molecules)>();
+    reactions.clear();
 
     Particle a, b;
     a = atoms[0];
@@ -253,6 +261,25 @@ TEST_CASE("[Faunus] CustomPairPotential") {
                 "function": "lB * q1 * q2 / (s1+s2) * exp(-kappa/r) * kT + pi"})"_json;
 
     CHECK(pot(a, b, 2 * 2, {0, 0, 2}) == Approx(-7 / (3.0 + 4.0) * std::exp(-30 / 2) * pc::kT() + pc::pi));
+
+    SUBCASE("Tabulated") {
+        CustomPairPotential tabulated = R"({
+                "constants": { "lB": 7}, "cutoff": 20, "rmin": 2, "tabulate": true, "utol": 1e-6,
+                "function": "lB * q1 * q2 / r"})"_json;
+        CHECK(tabulated(a, b, 5 * 5, {0, 0, 5}) == Approx(-7.0 / 5.0).epsilon(1e-5));
+        CHECK(tabulated(a, b, 1 * 1, {0, 0, 1}) == Approx(-7.0)); // outside table; evaluates expression
+        b.charge = -2.0;                                          // charge differs from atom type
+        CHECK(tabulated(a, b, 5 * 5, {0, 0, 5}) == Approx(-14.0 / 5.0));
+    }
+
+    SUBCASE("Tabulated with zero contact distance") {
+        Particle c = atoms[2];
+        CustomPairPotential tabulated; // rmin falls back to 1 Å for the C-C pair
+        CHECK_NOTHROW(tabulated.from_json(R"({
+                "constants": { "lB": 7}, "cutoff": 20, "tabulate": true, "utol": 1e-6,
+                "function": "lB * q1 * q2 / r"})"_json));
+        CHECK(tabulated(c, c, 5 * 5, {0, 0, 5}) == Approx(7.0 / 5.0).epsilon(1e-5));
+    }
 }
 
 TEST_CASE("[Faunus] FunctorPotential") {
@@ -313,6 +340,80 @@ TEST_CASE("[Faunus] FunctorPotential") {
     }
 }
 
+TEST_CASE("[Faunus] SplinedPotential") {
+    atoms = R"([ {"A": {"sigma": 2.0, "eps": 0.5}}, {"B": {"sigma": 4.0, "eps": 1.0}},
+                 {"C": {"sigma": 6.0, "eps": 0.1}} ])"_json.get<decltype(atoms)>();
+    json input = R"({"default": [ {"lennardjones": {"mixing": "LB"}} ], "cache": true})"_json;
+
+    Particle a = atoms[0], b = atoms[1], c = atoms[2];
+    auto energies = [&](const SplinedPotential &u) {
+        std::vector<double> energies;
+        for (double r = 2.0; r < 20.0; r += 0.1) {
+            energies.push_back(u(a, b, r * r, {r, 0, 0}));
+            energies.push_back(u(b, c, r * r, {r, 0, 0}));
+            energies.push_back(u(c, c, r * r, {r, 0, 0}));
+        }
+        return energies;
+    };
+
+    SplinedPotential generated;
+    generated.from_json(input);
+    const auto filename = generated.getCacheFilename();
+    REQUIRE_FALSE(filename.empty());
+    REQUIRE(std::ifstream(filename).good());
+    json cache = json::parse(std::ifstream(filename));
+
+    SUBCASE("hit") {
+        json zeroed = cache; // knots are taken from the cache rather than regenerated
+        for (auto &knots : zeroed) {
+            if (knots.is_object()) {
+                knots["c"] = std::vector<double>(knots["c"].size(), 0.0);
+            }
+        }
+        std::ofstream(filename) << zeroed;
+        SplinedPotential loaded;
+        loaded.from_json(input);
+        CHECK(loaded.getCacheFilename() == filename);
+        CHECK(loaded(a, b, 25.0, {5, 0, 0}) == 0.0);
+    }
+
+    SUBCASE("miss") {
+        input["utol"] = 1e-4; // different input gives a different file
+        SplinedPotential regenerated;
+        regenerated.from_json(input);
+        CHECK(regenerated.getCacheFilename() != filename);
+        CHECK(std::ifstream(regenerated.getCacheFilename()).good());
+        std::remove(regenerated.getCacheFilename().c_str());
+    }
+
+    SUBCASE("invalidation") {
+        cache["version"] = cache["version"].get<int>() - 1; // stale cache from another version is regenerated
+        std::ofstream(filename) << cache;
+        SplinedPotential regenerated;
+        regenerated.from_json(input);
+        CHECK(energies(regenerated) == energies(generated));
+        CHECK(json::parse(std::ifstream(filename)).at("version") == cache["version"].get<int>() + 1);
+    }
+
+    SUBCASE("parallel knot generation") {
+        input["cache"] = false;
+        FunctorPotential exact = input;
+        for (double r = 3.0; r < 20.0; r += 0.1) {
+            CHECK(std::fabs(generated(a, b, r * r, {r, 0, 0}) - exact(a, b, r * r, {r, 0, 0})) < 1e-2);
+            CHECK(std::fabs(generated(c, c, r * r, {r, 0, 0}) - exact(c, c, r * r, {r, 0, 0})) < 1e-2);
+        }
+#ifdef _OPENMP
+        const auto num_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        SplinedPotential serial;
+        serial.from_json(input);
+        omp_set_num_threads(num_threads);
+        CHECK(energies(serial) == energies(generated));
+#endif
+    }
+    std::remove(filename.c_str());
+}
+
 TEST_CASE("[Faunus] Dipole-dipole interactions") {
     json j = R"({ "atomlist" : [
                  {"A": { "mu":[1.0,0.0,0.0], "mulen":3.0 }},
@@ -242,6 +242,14 @@ PYBIND11_MODULE(pyfaunus, m)
         .def("findMolecules", &Space::findMolecules)
         .def("from_dict", [](Space &spc, py::dict dict) { from_json(dict2json(dict), spc); });
 
+    // IndexedSpaceTrajectoryReader
+    py::class_<IndexedSpaceTrajectoryReader>(m, "IndexedSpaceTrajectory")
+        .def(py::init<const std::string &>(), "filename"_a)
+        .def("__len__", &IndexedSpaceTrajectoryReader::size)
+        .def("load", &IndexedSpaceTrajectoryReader::load, "index"_a, "space"_a, "Load frame into space")
+        .def("frame", [](const IndexedSpaceTrajectoryReader &self, size_t index) {
+            return py::bytes(self.frame(index)); }, "index"_a, "Uncompressed frame data");
+
     // Hamiltonian
     py::class_<Thamiltonian>(m, "Hamiltonian")
         .def(py::init<Space &, const json &>())
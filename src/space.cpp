@@ -55,7 +55,8 @@ bool Change::sanityCheck(Space &spc) const {
 
 void to_json(json &j, const Change::data &d) {
     j = {{"all", d.all},           {"internal", d.internal}, {"dNswap", d.dNswap},
-         {"dNatomic", d.dNatomic}, {"index", d.index},       {"atoms", d.atoms}};
+         {"dNatomic", d.dNatomic}, {"index", d.index},       {"atoms", d.atoms},
+         {"moved2moved", d.moved2moved}};
 }
 
 void to_json(json &j, const Change &c) {
@@ -355,13 +356,18 @@ void makeNaCl(Space &space, int num_particles, const Geometry::Chameleon &geomet
  */
 void InsertMoleculesInSpace::insertAtomicGroups(MoleculeData &moldata, Space &spc, int num_molecules, bool inactive) {
     assert(moldata.atomic == true);
+    // to avoid overlap also with the atoms inserted so far, these follow a copy of the existing particles
+    const auto random_inserter = std::dynamic_pointer_cast<RandomInserter>(moldata.inserter);
+    const bool avoid_overlap = random_inserter && random_inserter->avoid_overlap;
+    const size_t num_existing = avoid_overlap ? spc.p.size() : 0;
     typename Space::Tpvec p;
-    p.reserve(num_molecules * moldata.atoms.size()); // prepare memory
-    while (num_molecules-- > 0) {                    // repeat insertion into the same atomic group
-        auto particles = moldata.getRandomConformation(spc.geo, spc.p);
+    p.reserve(num_existing + num_molecules * moldata.atoms.size()); // prepare memory
+    p.insert(p.end(), spc.p.begin(), spc.p.begin() + num_existing);
+    while (num_molecules-- > 0) { // repeat insertion into the same atomic group
+        auto particles = moldata.getRandomConformation(spc.geo, avoid_overlap ? p : spc.p);
         p.insert(p.end(), particles.begin(), particles.end());
     }
-    spc.push_back(moldata.id(), p);
+    spc.push_back(moldata.id(), typename Space::Tpvec(p.begin() + num_existing, p.end()));
     if (inactive) {
         spc.groups.back().resize(0);
     }
@@ -422,36 +428,85 @@ void InsertMoleculesInSpace::insertImplicitGroups(const MoleculeData &moldata, S
 }
 
 /**
- * @brief Insert molecules into Space based on JSON input
+ * @brief Number of molecules to insert, either given directly (`N`) or from the molarity
+ * @param moldata Molecule to insert
+ * @param properties JSON object with either `N` or `molarity`
+ * @param spc Space to insert into
+ */
+int InsertMoleculesInSpace::numberOfMolecules(const MoleculeData &moldata, const json &properties,
+                                              const Space &spc) {
+    int num_molecules = 0; // number of groups to insert
+    if (auto it = properties.find("N"); it != properties.end()) {
+        num_molecules = it->get<int>();
+    } else {
+        double concentration = properties.at("molarity").get<double>() * 1.0_molar;
+        num_molecules = std::round(concentration * spc.geo.getVolume());
+        if (concentration > pc::epsilon_dbl) {
+            double rel_error = (concentration - num_molecules / spc.geo.getVolume()) / concentration;
+            if (rel_error > 0.01) {
+                faunus_logger->warn("{}: initial molarity differs by {}% from target value", moldata.name,
+                                    rel_error * 100);
+            }
+        }
+    }
+    return num_molecules;
+}
+
+/**
+ * @brief Validate input, count molecules, and reserve memory for all particles and groups
+ *
+ * Without this, `Space::push_back()` may reallocate the particle vector and relocate all
+ * existing groups for every inserted molecule, making the insertion quadratic in the
+ * number of molecules.
+ *
  * @param json_array JSON array
  * @param spc Space to insert into
+ * @return Number of molecules for each item in the JSON array
  */
-void InsertMoleculesInSpace::insertMolecules(const json &json_array, Space &spc) {
-    spc.clear();
-    assert(spc.geo.getVolume() > 0);
+std::vector<int> InsertMoleculesInSpace::reserveMemory(const json &json_array, Space &spc) {
     if (!json_array.is_array()) {
         throw ConfigurationError("syntax error in insertmolecule");
     }
+    std::vector<int> molecule_counts;
+    size_t num_particles = 0, num_groups = 0;
     for (auto &obj : json_array) { // loop over array of molecules
         if (!obj.is_object() || obj.size() != 1) {
             throw ConfigurationError("syntax error in insertmolecule");
         }
         for (auto &[molname, properties] : obj.items()) {
             if (auto moldata = findName(Faunus::molecules, molname); moldata != Faunus::molecules.end()) {
-                int num_molecules = 0; // number of groups to insert
-                if (auto it = properties.find("N"); it != properties.end()) {
-                    num_molecules = it->get<int>();
-                } else {
-                    double concentration = properties.at("molarity").get<double>() * 1.0_molar;
-                    num_molecules = std::round(concentration * spc.geo.getVolume());
-                    if (concentration > pc::epsilon_dbl) {
-                        double rel_error = (concentration - num_molecules / spc.geo.getVolume()) / concentration;
-                        if (rel_error > 0.01) {
-                            faunus_logger->warn("{}: initial molarity differs by {}% from target value", molname,
-                                                rel_error * 100);
-                        }
-                    }
+                const int num_molecules = numberOfMolecules(*moldata, properties, spc);
+                molecule_counts.push_back(num_molecules);
+                if (!moldata->isImplicit() && num_molecules > 0) {
+                    num_particles += num_molecules * moldata->atoms.size();
+                    num_groups += moldata->atomic ? 1 : num_molecules;
                 }
+            } else {
+                throw ConfigurationError("cannot insert undefined molecule '" + molname + "'");
+            }
+        }
+    }
+    spc.p.reserve(num_particles);
+    spc.groups.reserve(num_groups);
+    return molecule_counts;
+}
+
+/**
+ * @brief Insert molecules into Space based on JSON input
+ * @param json_array JSON array
+ * @param spc Space to insert into
+ *
+ * Memory for all molecules is reserved before insertion, see `reserveMemory()`.
+ */
+void InsertMoleculesInSpace::insertMolecules(const json &json_array, Space &spc) {
+    spc.clear();
+    assert(spc.geo.getVolume() > 0);
+    const auto molecule_counts = reserveMemory(json_array, spc);
+    auto num_molecules_it = molecule_counts.begin();
+    for (auto &obj : json_array) { // loop over array of molecules
+        for (auto &[molname, properties] : obj.items()) {
+            if (auto moldata = findName(Faunus::molecules, molname); moldata != Faunus::molecules.end()) {
+                const int num_molecules = *num_molecules_it++; // number of groups to insert
                 if (not moldata->isImplicit() and num_molecules < 1) {
                     throw ConfigurationError(molname + ": at least one molecule required. Concentration too low?");
                 }
@@ -490,6 +545,11 @@ void InsertMoleculesInSpace::insertMolecules(const json &json_array, Space &spc)
             }
         }
     }
+    for (auto &moldata : Faunus::molecules) { // inserters need not remember this configuration
+        if (moldata.inserter) {
+            moldata.inserter->reset();
+        }
+    }
 }
 
 } // namespace Faunus
@@ -3,6 +3,8 @@
 #include "geometry.h"
 #include "group.h"
 #include "molecule.h"
+#include <cereal/types/map.hpp>
+#include <cereal/types/string.hpp>
 
 namespace Faunus {
 
@@ -33,6 +35,7 @@ struct Change {
         int index;              //!< Touched group index
         bool internal = false;  //!< True if the internal energy/config has changed
         bool all = false;       //!< True if all particles in group have been updated
+        bool moved2moved = true; //!< If false, pairs among `atoms` are unchanged, e.g. after a rigid rotation
         std::vector<int> atoms; //!< Touched atom index w. respect to `Group::begin()`
 
         bool operator<(const data &a) const;
@@ -243,6 +246,41 @@ class Space {
 
     json info();
 
+    /**
+     * @brief Cereal serialisation of geometry, particles, groups and implicit reservoirs
+     *
+     * Used for binary checkpoints where particles are streamed one by one
+     * without building an intermediate json object. All particles belong to a group
+     * and are written as part of it, including inactive ones.
+     */
+    template <class Archive> void save(Archive &archive) const {
+        archive(json(geo).dump(), p.size(), groups.size());
+        for (const auto &group : groups) {
+            archive(group);
+        }
+        archive(implicit_reservoir);
+    }
+
+    /**
+     * @brief Cereal deserialisation; see `save()`
+     *
+     * Space must already be constructed from a matching topology, i.e. with the same
+     * number of particles and groups, and with identical group capacities.
+     */
+    template <class Archive> void load(Archive &archive) {
+        std::string geometry;
+        size_t number_of_particles = 0, number_of_groups = 0;
+        archive(geometry, number_of_particles, number_of_groups);
+        if (number_of_particles != p.size() || number_of_groups != groups.size()) {
+            throw std::runtime_error("checkpoint does not match the system topology");
+        }
+        geo = json::parse(geometry);
+        for (auto &group : groups) {
+            archive(group);
+        }
+        archive(implicit_reservoir);
+    }
+
 }; // end of space
 
 void to_json(json &j, Space &spc); //!< Serialize Space to json object
@@ -271,6 +309,8 @@ class InsertMoleculesInSpace {
     static void insertMolecularGroups(MoleculeData &, Space &, int num_molecules, bool);
     static void setPositionsForTrailingGroups(Space &, int, const Faunus::ParticleVector &, const Point &);
     static void insertImplicitGroups(const MoleculeData &, Space &, int);
+    static int numberOfMolecules(const MoleculeData &, const json &, const Space &); //!< From `N` or `molarity`
+    static std::vector<int> reserveMemory(const json &, Space &); //!< Count molecules and reserve memory
 
   public:
     static void insertMolecules(const json &, Space &);
@@ -130,8 +130,38 @@ TEST_CASE("[Faunus] Space") {
         Space spc;
         SpaceFactory::makeNaCl(spc, 10, R"( {"type": "cuboid", "length": 20} )"_json);
         CHECK(spc.numParticles() == 20);
+        CHECK(spc.p.capacity() == spc.p.size()); // memory reserved up-front, i.e. never reallocated
     }
 }
 
+TEST_CASE("[Faunus] InsertMoleculesInSpace - avoid_overlap") {
+    atoms = R"([{"A": {"sigma": 3.0}}, {"B": {"sigma": 2.0}}])"_json.get<decltype(atoms)>();
+    molecules = R"([
+        {"dimer": {"avoid_overlap": true, "structure": [ {"A": [0.0, 0.0, 0.0]}, {"A": [3.0, 0.0, 0.0]} ]}},
+        {"salt": {"atomic": true, "atoms": ["A", "B"], "avoid_overlap": true}}
+    ])"_json.get<decltype(molecules)>();
+    Space spc;
+    spc.geo = R"( {"type": "cuboid", "length": 30} )"_json;
+    InsertMoleculesInSpace::insertMolecules(R"([ {"dimer": {"N": 50}}, {"salt": {"N": 100}} ])"_json, spc);
+    REQUIRE(spc.p.size() == 300);
+
+    // only atoms within the same molecular group may overlap
+    int num_overlaps = 0;
+    for (auto group1 = spc.groups.begin(); group1 != spc.groups.end(); ++group1) {
+        for (auto group2 = group1; group2 != spc.groups.end(); ++group2) {
+            if (group1 == group2 && !group1->atomic) {
+                continue;
+            }
+            for (auto a = group1->begin(); a != group1->end(); ++a) {
+                for (auto b = (group1 == group2 ? std::next(a) : group2->begin()); b != group2->end(); ++b) {
+                    const double contact_distance = 0.5 * (atoms[a->id].sigma + atoms[b->id].sigma);
+                    num_overlaps += spc.geo.sqdist(a->pos, b->pos) < contact_distance * contact_distance - 1e-9;
+                }
+            }
+        }
+    }
+    CHECK(num_overlaps == 0);
+}
+
 TEST_SUITE_END();
 } // namespace Faunus
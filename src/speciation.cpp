@@ -6,6 +6,36 @@
 namespace Faunus {
 namespace Move {
 
+void CavityGrid::resize(const Point &length, double cell_length) {
+    box_length = length;
+    num_cells = (box_length.array() / cell_length).floor().cast<int>().max(1).matrix();
+    cell_size = box_length.cwiseQuotient(num_cells.cast<double>());
+    occupancy.assign(num_cells.prod(), 0);
+    empty_cells.clear();
+}
+
+int CavityGrid::cellIndex(const Point &position) const {
+    Eigen::Vector3i cell = ((position + 0.5 * box_length).cwiseQuotient(cell_size)).array().floor().cast<int>();
+    cell = cell.cwiseMax(0).cwiseMin(num_cells - Eigen::Vector3i::Ones()); // guard against round-off at the edges
+    return cell.x() + num_cells.x() * (cell.y() + num_cells.y() * cell.z());
+}
+
+bool CavityGrid::isCavity(const Point &position) const { return occupancy[cellIndex(position)] == 0; }
+
+double CavityGrid::cavityFraction() const {
+    return occupancy.empty() ? 0.0 : static_cast<double>(empty_cells.size()) / static_cast<double>(occupancy.size());
+}
+
+void CavityGrid::randomPosition(Point &position, Random &random) const {
+    assert(not empty_cells.empty());
+    int index = *random.sample(empty_cells.begin(), empty_cells.end());
+    const Eigen::Vector3i cell(index % num_cells.x(), (index / num_cells.x()) % num_cells.y(),
+                               index / (num_cells.x() * num_cells.y()));
+    for (int k = 0; k < 3; k++) {
+        position[k] = (cell[k] + random()) * cell_size[k] - 0.5 * box_length[k];
+    }
+}
+
 void SpeciationMove::_to_json(json &j) const {
     json &_j = j["reactions"];
     _j = json::object();
@@ -17,6 +47,9 @@ void SpeciationMove::_to_json(json &j) const {
     for (auto [molid, size] : average_reservoir_size) {
         j["implicit_reservoir"][molecules[molid].name] = size.avg();
     }
+    if (cavity_cell_length > 0.0) {
+        j["cavity_bias"] = cavity_cell_length;
+    }
 }
 
 /**
@@ -130,6 +163,7 @@ Change::data SpeciationMove::contractAtomicGroup(Space::Tgroup &target, Space::T
             }
 
             change_data.atoms.push_back(std::distance(target.begin(), last_atom));
+            deleted_positions.push_back(last_atom->pos);
             target.deactivate(last_atom, target.end()); // deactivate a single atom at the time
         }
         std::sort(change_data.atoms.begin(), change_data.atoms.end());
@@ -140,6 +174,20 @@ Change::data SpeciationMove::contractAtomicGroup(Space::Tgroup &target, Space::T
     return change_data;
 }
 
+/**
+ * Internal bond energy of a molecular group. The bonds of the molecule type have indices relative
+ * to the first particle in the group and are evaluated in place, i.e. without copying bond data
+ * or creating energy functors.
+ */
+double SpeciationMove::internalBondEnergy(const Space::Tgroup &group) const {
+    const auto distance = spc.geo.getDistanceFunc();
+    double energy = 0.0;
+    for (const auto &bond : Faunus::molecules[group.id].bonds) {
+        energy += bond->energy(group.begin(), distance);
+    }
+    return energy;
+}
+
 /**
  * Deactivate a single, active molecular group. If there are internal bonds, the total
  * bond energy is stored and used to avoid that the bond energy affect acceptance.
@@ -153,13 +201,8 @@ Change::data SpeciationMove::deactivateMolecularGroup(Space::Tgroup &target) {
 
     target.unwrap(spc.geo.getDistanceFunc()); // when in storage, remove PBC
 
-    // Store internal bond energy of the deactivated molecule
-    for (auto &bond : Faunus::molecules.at(target.id).bonds) {
-        auto bond_clone = bond->clone();
-        bond_clone->shift(std::distance(spc.p.begin(), target.begin()));
-        Potential::setBondEnergyFunction(bond_clone, spc.p);
-        bond_energy += bond_clone->energyFunc(spc.geo.getDistanceFunc());
-    }
+    bond_energy += internalBondEnergy(target); // store internal bond energy of the deactivated molecule
+    deleted_positions.push_back(target.cm);
 
     target.deactivate(target.begin(), target.end()); // deactivate whole group
     assert(target.empty());
@@ -193,7 +236,7 @@ Change::data SpeciationMove::expandAtomicGroup(Space::Tgroup &target, int number
         for (int i = 0; i < number_to_insert; i++) {
             target.activate(target.end(), target.end() + 1); // activate one particle
             auto last_atom = target.end() - 1;
-            spc.geo.randompos(last_atom->pos, slump);                              // give it a random position
+            insertionPosition(last_atom->pos);                                     // give it a random position
             spc.geo.getBoundaryFunc()(last_atom->pos);                             // apply PBC if needed
             change_data.atoms.push_back(std::distance(target.begin(), last_atom)); // index relative to group
         }
@@ -215,7 +258,7 @@ Change::data SpeciationMove::activateMolecularGroup(Space::Tgroup &target) {
     assert(not target.empty());
 
     Point cm = target.cm;
-    spc.geo.randompos(cm, slump);                    // generate random position
+    insertionPosition(cm);                           // generate random position
     target.translate(cm, spc.geo.getBoundaryFunc()); // assign random position to mass-center
     Point u = ranunit(slump);                        // random unit vector
     Eigen::Quaterniond Q(Eigen::AngleAxisd(2 * pc::pi * (slump() - 0.5), u));
@@ -224,13 +267,7 @@ Change::data SpeciationMove::activateMolecularGroup(Space::Tgroup &target) {
     assert(spc.geo.sqdist(target.cm, Geometry::massCenter(target.begin(), target.end(), spc.geo.getBoundaryFunc(),
                                                           -target.cm)) < 1e-9);
 
-    // Store internal bond energy of activated molecule
-    for (auto &bond : Faunus::molecules[target.id].bonds) {
-        auto bondclone = bond->clone();
-        bondclone->shift(std::distance(spc.p.begin(), target.begin()));
-        Potential::setBondEnergyFunction(bondclone, spc.p);
-        bond_energy -= bondclone->energyFunc(spc.geo.getDistanceFunc());
-    }
+    bond_energy -= internalBondEnergy(target); // store internal bond energy of activated molecule
 
     Change::data d;                          // describes the changed - used for energy evaluation
     d.index = &target - &spc.groups.front(); // index* of moved group
@@ -394,6 +431,48 @@ bool SpeciationMove::deactivateAllReactants(Change &change) {
     return true;
 }
 
+/**
+ * For cavity-biased insertion, cavities are the empty cells of a coarse grid, binning all active particles
+ * except the ones inserted or deleted by the reaction. Particles are then inserted uniformly in
+ * cavities, at a volume fraction `f`, rather than anywhere in the volume. Microscopic reversibility
+ * is maintained by the bias `-ln f` for each insertion and `ln f` for each deletion, and by
+ * rejecting deletions of particles (mass centers) outside cavities, as these could never be re-inserted.
+ *
+ * This must be called after deactivation of reactants, but before activation of products.
+ * The grid is rebuilt every time since other moves change positions in between speciation moves;
+ * binning is a single, cheap pass over the particles.
+ */
+void SpeciationMove::updateCavities() {
+    if (cavity_cell_length > 0.0) {
+        cavity_grid.update(spc.geo.getLength(), cavity_cell_length, spc.activeParticles());
+        const auto log_fraction = std::log(cavity_grid.cavityFraction());
+        for (const auto &position : deleted_positions) {
+            if (not cavity_grid.isCavity(position)) {
+                cavity_bias = pc::infty; // reverse insertion is impossible
+                break;
+            }
+            cavity_bias += log_fraction;
+        }
+    }
+}
+
+/**
+ * Uniform random position in the simulation container or, for cavity-biased insertion,
+ * in a random cavity. If there are no cavities, the insertion is impossible and the
+ * move is rejected through the bias.
+ */
+void SpeciationMove::insertionPosition(Point &position) {
+    if (cavity_cell_length > 0.0) {
+        if (cavity_grid.cavityFraction() > 0.0) {
+            cavity_grid.randomPosition(position, slump);
+            cavity_bias -= std::log(cavity_grid.cavityFraction());
+            return;
+        }
+        cavity_bias = pc::infty;
+    }
+    spc.geo.randompos(position, slump);
+}
+
 /**
  * Checks if there is enough implicit molecules to carry out the reaction
  */
@@ -427,9 +506,12 @@ void SpeciationMove::_move(Change &change) {
         reaction->setDirection(direction);
 
         bond_energy = 0;
+        cavity_bias = 0;
+        deleted_positions.clear();
 
         if (atomicSwap(change)) {
             if (deactivateAllReactants(change)) {
+                updateCavities();
                 if (activateAllProducts(change)) {
                     assert(not change.empty());
                     change.dN = true; // Attempting to change the number of atoms / molecules
@@ -445,7 +527,7 @@ void SpeciationMove::_move(Change &change) {
 double SpeciationMove::bias(Change &, double, double) {
     // The acceptance/rejection of the move is affected by the equilibrium constant
     // but unaffected by the change in bonded energy
-    return -reaction->lnK + bond_energy;
+    return -reaction->lnK + bond_energy + cavity_bias;
 }
 
 void SpeciationMove::_accept(Change &) {
@@ -497,7 +579,15 @@ SpeciationMove::SpeciationMove(Tspace &spc) : spc(spc) {
     name = "rcmc";
     cite = "doi:10/fqcpg3";
 }
-void SpeciationMove::_from_json(const json &) {}
+void SpeciationMove::_from_json(const json &j) {
+    cavity_cell_length = j.value("cavity_bias", 0.0);
+    if (cavity_cell_length < 0.0) {
+        throw ConfigurationError("cavity_bias must be positive");
+    }
+    if (cavity_cell_length > 0.0 && spc.geo.type != Geometry::CUBOID && spc.geo.type != Geometry::SLIT) {
+        throw ConfigurationError("cavity_bias requires a cuboid or slit geometry");
+    }
+}
 
 } // end of namespace Move
 } // end of namespace Faunus
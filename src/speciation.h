@@ -5,6 +5,49 @@
 namespace Faunus {
 namespace Move {
 
+/**
+ * @brief Coarse occupancy grid of a box, used for cavity-biased insertion
+ *
+ * The box is divided into cells with edge lengths close to, but not smaller than, a given length.
+ * Cells that contain no particles are cavities, and positions can be drawn uniformly from their union.
+ * As the cells tile the box, the cavity volume fraction is the fraction of empty cells.
+ */
+class CavityGrid {
+    Eigen::Vector3i num_cells = {0, 0, 0}; //!< number of cells in each dimension
+    Point box_length = {0, 0, 0};         //!< side lengths of the box
+    Point cell_size = {0, 0, 0};          //!< side lengths of a cell
+    std::vector<int> occupancy;           //!< number of particles in each cell
+    std::vector<int> empty_cells;         //!< indices of all empty cells
+
+  public:
+    int cellIndex(const Point &position) const;                 //!< Index of cell containing position
+    template <typename TParticles> void update(const Point &box_length, double cell_length, TParticles &&particles);
+    void resize(const Point &box_length, double cell_length);   //!< Set dimensions and clear occupancy
+    bool isCavity(const Point &position) const;                  //!< True if position is in an empty cell
+    double cavityFraction() const;                               //!< Volume fraction of empty cells
+    void randomPosition(Point &position, Random &random) const; //!< Uniform position in an empty cell
+};
+
+/**
+ * @brief Bin particles and find all cavities
+ * @param box_length Side lengths of the box
+ * @param cell_length Minimum side length of a cell
+ * @param particles Range of particles to bin
+ */
+template <typename TParticles>
+void CavityGrid::update(const Point &box_length, double cell_length, TParticles &&particles) {
+    resize(box_length, cell_length);
+    for (const Particle &particle : particles) {
+        occupancy[cellIndex(particle.pos)]++;
+    }
+    empty_cells.clear();
+    for (int i = 0; i < static_cast<int>(occupancy.size()); i++) {
+        if (occupancy[i] == 0) {
+            empty_cells.push_back(i);
+        }
+    }
+}
+
 /**
  * @brief Generalised Grand Canonical Monte Carlo Move
  *
@@ -27,6 +70,11 @@ class SpeciationMove : public Movebase {
     double bond_energy = 0;     //!< Accumulated bond energy if inserted/deleted molecule
     reaction_iterator reaction; //!< Randomly selected reaction
 
+    double cavity_cell_length = 0.0;      //!< Cell length for cavity-biased insertion; disabled if zero
+    CavityGrid cavity_grid;               //!< Empty cells in between particles not taking part in the reaction
+    std::vector<Point> deleted_positions; //!< Positions (mass centers) of deleted particles (molecules)
+    double cavity_bias = 0.0;             //!< Accumulated bias due to cavity-biased insertion and deletion
+
     class AcceptanceData {
       public:
         Average<double> right, left;
@@ -50,11 +98,14 @@ class SpeciationMove : public Movebase {
     bool atomicSwap(Change &);             //!< Swap atom type
     bool deactivateAllReactants(Change &); //!< Delete reactant species
     bool activateAllProducts(Change &);    //!< Insert product species
+    void updateCavities();                 //!< Find cavities and bias of deleted species
+    void insertionPosition(Point &);       //!< Random insertion position, possibly in a cavity
 
     Change::data contractAtomicGroup(Space::Tgroup &, Space::Tgroup &, int);  //!< Contract atomic group
     Change::data expandAtomicGroup(Space::Tgroup &, int);                     //!< Expand atomic group
     Change::data activateMolecularGroup(Space::Tgroup &);                     //!< Activate molecular group
     Change::data deactivateMolecularGroup(Space::Tgroup &);                   //!< Deactivate molecular group
+    double internalBondEnergy(const Space::Tgroup &) const;                   //!< Bond energy within molecular group
 
   public:
     SpeciationMove(Space &);
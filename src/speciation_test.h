@@ -0,0 +1,47 @@
+#pragma once
+#include "speciation.h"
+
+namespace Faunus {
+namespace Move {
+
+using doctest::Approx;
+
+TEST_SUITE_BEGIN("Speciation");
+
+TEST_CASE("[Faunus] CavityGrid") {
+    CavityGrid grid;
+    const Point box_length = {10.0, 10.0, 10.0};
+    ParticleVector particles(2);
+    particles[0].pos = {0.0, 0.0, 0.0};    // center cell
+    particles[1].pos = {-4.9, -4.9, -4.9}; // first cell
+    grid.update(box_length, 3.0, particles); // 3×3×3 cells
+
+    CHECK(grid.cellIndex({-4.9, -4.9, -4.9}) == 0);
+    CHECK(grid.cellIndex({0.0, 0.0, 0.0}) == 13);
+    CHECK(grid.cellIndex({5.0, 5.0, 5.0}) == 26); // edge is clamped to the last cell
+    CHECK(grid.cavityFraction() == Approx(25.0 / 27.0));
+    CHECK_FALSE(grid.isCavity({1.0, -1.0, 1.5}));
+    CHECK_FALSE(grid.isCavity({-3.5, -3.5, -3.5}));
+    CHECK(grid.isCavity({4.0, 0.0, 0.0}));
+
+    Random random;
+    Point position;
+    for (int i = 0; i < 1000; i++) {
+        grid.randomPosition(position, random);
+        CHECK(grid.isCavity(position));
+        CHECK(position.cwiseAbs().maxCoeff() <= 5.0);
+    }
+
+    particles.resize(27); // fill all cells
+    for (int i = 0; i < 27; i++) {
+        particles[i].pos = {-5.0 + (i % 3 + 0.5) * 10.0 / 3.0, -5.0 + ((i / 3) % 3 + 0.5) * 10.0 / 3.0,
+                            -5.0 + (i / 9 + 0.5) * 10.0 / 3.0};
+    }
+    grid.update(box_length, 3.0, particles);
+    CHECK(grid.cavityFraction() == Approx(0.0));
+}
+
+TEST_SUITE_END();
+
+} // namespace Move
+} // namespace Faunus
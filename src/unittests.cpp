@@ -16,6 +16,7 @@
 #include "atomdata_test.h"
 #include "auxiliary_test.h"
 #include "bonds_test.h"
+#include "chainmove_test.h"
 #include "core_test.h"
 #include "energy_test.h"
 #include "forcemove_test.h"
@@ -28,6 +29,8 @@
 #include "tensor_test.h"
 #include "externalpotential_test.h"
 #include "scatter_test.h"
+#include "montecarlo_test.h"
+#include "speciation_test.h"
 
 #include "mpicontroller.h"
 #include "auxiliary.h"